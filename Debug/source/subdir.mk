@@ -6,29 +6,92 @@
 C_SRCS += \
 ../source/CG2271UART.c \
 ../source/actuator_driver.c \
+../source/actuator_mailbox.c \
+../source/audio_clips.c \
+../source/audio_player.c \
+../source/cmd_token.c \
+../source/deadline_monitor.c \
+../source/dht11.c \
+../source/event_hub.c \
+../source/fast_fmt.c \
+../source/log.c \
+../source/log_console.c \
+../source/log_token.c \
+../source/low_power.c \
 ../source/main.c \
 ../source/mtb.c \
 ../source/music_library.c \
+../source/mutex_profile.c \
+../source/plant_rules.c \
+../source/pwm_service.c \
+../source/rtos_bench.c \
+../source/rtos_objects.c \
+../source/rtos_stats.c \
+../source/runtime_clock.c \
 ../source/semihost_hardfault.c \
-../source/sensor.c 
+../source/sensor.c \
+../source/stack_monitor.c \
+../source/trace_recorder.c 
 
 C_DEPS += \
 ./source/CG2271UART.d \
 ./source/actuator_driver.d \
+./source/actuator_mailbox.d \
+./source/audio_clips.d \
+./source/audio_player.d \
+./source/cmd_token.d \
+./source/deadline_monitor.d \
+./source/dht11.d \
+./source/event_hub.d \
+./source/fast_fmt.d \
+./source/log.d \
+./source/log_console.d \
+./source/log_token.d \
+./source/low_power.d \
 ./source/main.d \
 ./source/mtb.d \
 ./source/music_library.d \
+./source/mutex_profile.d \
+./source/plant_rules.d \
+./source/pwm_service.d \
+./source/rtos_bench.d \
+./source/rtos_objects.d \
+./source/rtos_stats.d \
+./source/runtime_clock.d \
 ./source/semihost_hardfault.d \
-./source/sensor.d 
+./source/sensor.d \
+./source/stack_monitor.d \
+./source/trace_recorder.d 
 
 OBJS += \
 ./source/CG2271UART.o \
 ./source/actuator_driver.o \
+./source/actuator_mailbox.o \
+./source/audio_clips.o \
+./source/audio_player.o \
+./source/cmd_token.o \
+./source/deadline_monitor.o \
+./source/dht11.o \
+./source/event_hub.o \
+./source/fast_fmt.o \
+./source/log.o \
+./source/log_console.o \
+./source/log_token.o \
+./source/low_power.o \
 ./source/main.o \
 ./source/mtb.o \
 ./source/music_library.o \
+./source/mutex_profile.o \
+./source/plant_rules.o \
+./source/pwm_service.o \
+./source/rtos_bench.o \
+./source/rtos_objects.o \
+./source/rtos_stats.o \
+./source/runtime_clock.o \
 ./source/semihost_hardfault.o \
-./source/sensor.o 
+./source/sensor.o \
+./source/stack_monitor.o \
+./source/trace_recorder.o 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -43,7 +106,7 @@ source/%.o: ../source/%.c source/subdir.mk
 clean: clean-source
 
 clean-source:
-	-$(RM) ./source/CG2271UART.d ./source/CG2271UART.o ./source/actuator_driver.d ./source/actuator_driver.o ./source/main.d ./source/main.o ./source/mtb.d ./source/mtb.o ./source/music_library.d ./source/music_library.o ./source/semihost_hardfault.d ./source/semihost_hardfault.o ./source/sensor.d ./source/sensor.o
+	-$(RM) ./source/CG2271UART.d ./source/CG2271UART.o ./source/actuator_driver.d ./source/actuator_driver.o ./source/actuator_mailbox.d ./source/actuator_mailbox.o ./source/audio_clips.d ./source/audio_clips.o ./source/audio_player.d ./source/audio_player.o ./source/cmd_token.d ./source/cmd_token.o ./source/deadline_monitor.d ./source/deadline_monitor.o ./source/dht11.d ./source/dht11.o ./source/event_hub.d ./source/event_hub.o ./source/fast_fmt.d ./source/fast_fmt.o ./source/log.d ./source/log.o ./source/log_console.d ./source/log_console.o ./source/log_token.d ./source/log_token.o ./source/low_power.d ./source/low_power.o ./source/main.d ./source/main.o ./source/mtb.d ./source/mtb.o ./source/music_library.d ./source/music_library.o ./source/mutex_profile.d ./source/mutex_profile.o ./source/plant_rules.d ./source/plant_rules.o ./source/pwm_service.d ./source/pwm_service.o ./source/rtos_bench.d ./source/rtos_bench.o ./source/rtos_objects.d ./source/rtos_objects.o ./source/rtos_stats.d ./source/rtos_stats.o ./source/runtime_clock.d ./source/runtime_clock.o ./source/semihost_hardfault.d ./source/semihost_hardfault.o ./source/sensor.d ./source/sensor.o ./source/stack_monitor.d ./source/stack_monitor.o ./source/trace_recorder.d ./source/trace_recorder.o
 
 .PHONY: clean-source
 
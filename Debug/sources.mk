@@ -22,7 +22,6 @@ device \
 drivers \
 freertos/freertos-kernel \
 freertos/freertos-kernel/portable/GCC/ARM_CM0 \
-freertos/freertos-kernel/portable/MemMang \
 source \
 startup \
 utilities/debug_console \
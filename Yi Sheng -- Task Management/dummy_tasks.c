@@ -2,13 +2,13 @@
 #include "project_config.h"
 #include "sensor_driver.h"  // For SensorData_t
 #include "actuator_driver.h"// For ActuatorCommand_t
+#include "actuator_mailbox.h"// Coalescing actuator command mailbox
 #include "fsl_debug_console.h" // For PRINTF
 #include "queue.h"
 #include "semphr.h"
 
 // --- Global RTOS Handles (defined in main.c or rtos_manager.c) ---
 extern QueueHandle_t xSensorQueue;
-extern QueueHandle_t xActuatorQueue;
 extern SemaphoreHandle_t xWaterLevelSemaphore;
 
 // --- Dummy Task Implementations ---
@@ -45,22 +45,24 @@ void Dummy_Sensor_Polling_Task(void *pvParameters) {
 
 /**
  * @brief Dummy task simulating actuator control.
- * Waits for commands on xActuatorQueue and prints them.
+ * Waits for commands on the actuator mailbox and prints them.
  */
 void Dummy_Actuator_Control_Task(void *pvParameters) {
     PRINTF("[Dummy Actuator Task]: Started. Waiting for commands...\r\n");
     ActuatorCommand_t received_command;
+    bool is_alert;
 
     for (;;) {
-        // Wait indefinitely for a command
-        if (xQueueReceive(xActuatorQueue, &received_command, portMAX_DELAY) == pdPASS) {
-            PRINTF("[Dummy Actuator Task]: Received Command -> Type: %d, Val1: %lu, Val2: %lu\r\n",
+        // Wait indefinitely for a command (alerts are always handed out first)
+        if (ActuatorMailbox_Receive(&received_command, &is_alert, portMAX_DELAY) == pdPASS) {
+            PRINTF("[Dummy Actuator Task]: Received %s Command -> Type: %d, Val1: %lu, Val2: %lu\r\n",
+                   is_alert ? "ALERT" : "normal",
                    received_command.type, received_command.value1, received_command.value2);
 
             // Simulate doing something based on the command
             switch(received_command.type) {
                 case ACTUATOR_LED:
-                    PRINTF("    -> Simulating Set LED Brightness to %lu%%\r\n", received_command.value1);
+                    PRINTF("    -> Simulating Set LED Intensity to %lu/255\r\n", received_command.value1);
                     break;
                 case ACTUATOR_BUZZER_TONE:
                      PRINTF("    -> Simulating Play Buzzer Tone: Freq=%lu Hz, Duration=%lu ms\r\n",
@@ -72,6 +74,9 @@ void Dummy_Actuator_Control_Task(void *pvParameters) {
                  case ACTUATOR_BUZZER_MUSIC_STRESSED:
                      PRINTF("    -> Simulating Play Stressed Music\r\n");
                     break;
+                 case ACTUATOR_BUZZER_ALERT:
+                     PRINTF("    -> Simulating Play Alert Pattern\r\n");
+                    break;
                 default:
                     PRINTF("    -> Simulating Unknown Actuator Command\r\n");
                     break;
@@ -83,7 +88,7 @@ void Dummy_Actuator_Control_Task(void *pvParameters) {
 
 /**
  * @brief Dummy task simulating plant logic.
- * Waits for data on xSensorQueue, prints it, and sends dummy commands to xActuatorQueue.
+ * Waits for data on xSensorQueue, prints it, and posts dummy commands to the actuator mailbox.
  */
 void Dummy_Plant_Logic_Task(void *pvParameters) {
     PRINTF("[Dummy Logic Task]: Started. Waiting for sensor data...\r\n");
@@ -100,16 +105,16 @@ void Dummy_Plant_Logic_Task(void *pvParameters) {
              if (received_data.source == SENSOR_PHOTORESISTOR) {
                  if (received_data.value1 < 300) { // If light is low
                      command_to_send.type = ACTUATOR_LED;
-                     command_to_send.value1 = 80; // Set LED to 80%
+                     command_to_send.value1 = 204; // Set LED to ~80%
                      command_to_send.value2 = 0;
                      PRINTF("[Dummy Logic Task]: Light low, sending LED command.\r\n");
-                     xQueueSend(xActuatorQueue, &command_to_send, pdMS_TO_TICKS(100));
+                     ActuatorMailbox_Post(&command_to_send);
                  } else if (received_data.value1 > 800) { // If light is high
                       command_to_send.type = ACTUATOR_LED;
-                     command_to_send.value1 = 10; // Set LED to 10%
+                     command_to_send.value1 = 26; // Set LED to ~10%
                      command_to_send.value2 = 0;
                       PRINTF("[Dummy Logic Task]: Light high, sending LED command.\r\n");
-                     xQueueSend(xActuatorQueue, &command_to_send, pdMS_TO_TICKS(100));
+                     ActuatorMailbox_Post(&command_to_send);
                  }
              } else if (received_data.source == SENSOR_DHT11) {
                  if (received_data.value1 > 30.0) { // If temperature is high
@@ -117,7 +122,7 @@ void Dummy_Plant_Logic_Task(void *pvParameters) {
                      command_to_send.value1 = 0;
                      command_to_send.value2 = 0;
                      PRINTF("[Dummy Logic Task]: Temp high, sending Stressed Music command.\r\n");
-                     xQueueSend(xActuatorQueue, &command_to_send, pdMS_TO_TICKS(100));
+                     ActuatorMailbox_Post(&command_to_send);
                  }
              }
         }
@@ -140,16 +145,21 @@ void Dummy_Water_Danger_Task(void *pvParameters) {
             PRINTF("[Dummy Water Danger Task]: LOW WATER LEVEL DETECTED!\r\n");
             PRINTF("!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!\r\n");
 
-            // Simulate sending urgent commands (e.g., flash LED, loud buzzer tone)
+            // Urgent commands go through the alert lane: they jump ahead of any
+            // pending LED/music updates and are never coalesced away.
             command_to_send.type = ACTUATOR_LED;
-            command_to_send.value1 = 100; // Max brightness
+            command_to_send.value1 = 255; // Max brightness
             command_to_send.value2 = 0;
-            xQueueSend(xActuatorQueue, &command_to_send, 0); // Send immediately
+            if (ActuatorMailbox_PostAlert(&command_to_send) != pdPASS) {
+                PRINTF("[Dummy Water Danger Task]: Alert lane full, LED alert dropped!\r\n");
+            }
 
             command_to_send.type = ACTUATOR_BUZZER_TONE;
             command_to_send.value1 = 2000; // High pitch tone
             command_to_send.value2 = 1000; // Play for 1 second
-             xQueueSend(xActuatorQueue, &command_to_send, 0);
+            if (ActuatorMailbox_PostAlert(&command_to_send) != pdPASS) {
+                PRINTF("[Dummy Water Danger Task]: Alert lane full, buzzer alert dropped!\r\n");
+            }
 
             // Simulate task might suspend or wait for condition to clear after alerting
             vTaskDelay(pdMS_TO_TICKS(5000)); // Delay for 5 seconds before waiting again
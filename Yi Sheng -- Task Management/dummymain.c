@@ -60,7 +60,6 @@
 /*-----------------------------------------------------------*/
 // Define the handles that are declared as 'extern' in other files
 QueueHandle_t xSensorQueue = NULL;
-QueueHandle_t xActuatorQueue = NULL;
 SemaphoreHandle_t xUARTMutex = NULL;
 SemaphoreHandle_t xWaterLevelSemaphore = NULL; // Use this name consistently
 
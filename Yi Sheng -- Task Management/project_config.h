@@ -6,7 +6,7 @@
 
 // --- RTOS Object Sizes ---
 #define SENSOR_QUEUE_LENGTH     10 // Max items in sensor data queue
-#define ACTUATOR_QUEUE_LENGTH   5  // Max items in actuator command queue
+// Actuator commands use actuator_mailbox.h (per-actuator slots + ACTUATOR_ALERT_DEPTH alert lane)
 
 // --- Task Stack Sizes (in words) ---
 // Adjust these based on task complexity and local variable usage
@@ -2,6 +2,7 @@
 #include "project_config.h" // For task stack sizes and priorities
 #include "sensor_driver.h"  // For SensorData_t struct definition
 #include "actuator_driver.h"// For ActuatorCommand_t struct definition
+#include "actuator_mailbox.h"// Actuator command mailbox (replaces xActuatorQueue)
 #include "fsl_debug_console.h" // For PRINTF
 
 // --- Global RTOS Handles ---
@@ -9,11 +10,9 @@
 // Ensure they are DEFINED (not extern) in one C file, e.g., main.c
 // Example definition in main.c:
 //   QueueHandle_t xSensorQueue = NULL;
-//   QueueHandle_t xActuatorQueue = NULL;
 //   SemaphoreHandle_t xUARTMutex = NULL;
 //   SemaphoreHandle_t xWaterLevelSemaphore = NULL;
 extern QueueHandle_t xSensorQueue;
-extern QueueHandle_t xActuatorQueue;
 extern SemaphoreHandle_t xUARTMutex;
 extern SemaphoreHandle_t xWaterLevelSemaphore;
 
@@ -40,14 +39,10 @@ void RTOS_Objects_Init(void) {
     }
     vQueueAddToRegistry(xSensorQueue, "SensorQueue"); // Optional: Name for debugger view
 
-    // 2. Create the queue for actuator commands (LED, Buzzer)
-    // Logic task writes here, Actuator task reads from here.
-    xActuatorQueue = xQueueCreate(ACTUATOR_QUEUE_LENGTH, sizeof(ActuatorCommand_t));
-     if (xActuatorQueue == NULL) {
-        PRINTF("Error creating Actuator Queue!\r\n");
-        while(1);
-    }
-    vQueueAddToRegistry(xActuatorQueue, "ActuatorQueue");
+    // 2. Create the actuator command mailbox (LED, Buzzer)
+    // Logic/Water tasks post here, Actuator task receives from here.
+    // One latest-value-wins slot per actuator plus a priority lane for alerts.
+    ActuatorMailbox_Init();
 
     // 3. Create the mutex to protect UART1 communication with ESP32
     // Ensures only one task accesses UART1 at a time.
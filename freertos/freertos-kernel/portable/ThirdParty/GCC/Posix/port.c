@@ -0,0 +1,499 @@
+/*
+ * FreeRTOS Kernel V11.1.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the Posix port.
+ *
+ * Each task has a pthread which eases use of standard debuggers
+ * (allowing backtraces of tasks etc). Threads for tasks that are not
+ * running are blocked in event_wait(); only the thread of the task that
+ * the kernel has selected ever runs kernel code.
+ *
+ * Task switch is done by resuming the thread for the next task by
+ * signaling its event, then suspending the thread of the old task.
+ *
+ * The tick is SIGALRM from an interval timer. It is blocked in every thread
+ * except the running task's, so the handler always runs on that task's
+ * thread, which it may suspend. "Disabling interrupts" blocks SIGALRM in
+ * the running thread; a yield requested meanwhile is held until the signal
+ * is unblocked again, as PendSV would be on a Cortex-M.
+ *----------------------------------------------------------*/
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "utils/wait_for_event.h"
+/*-----------------------------------------------------------*/
+
+#define SIG_TICK    SIGALRM
+
+typedef struct THREAD
+{
+    pthread_t pthread;
+    TaskFunction_t pxCode;
+    void * pvParams;
+    BaseType_t xDying;
+    struct event * ev;
+} Thread_t;
+
+/*
+ * The additional per-thread data is stored at the beginning of the
+ * task's stack.
+ */
+static inline Thread_t * prvGetThreadFromTask( TaskHandle_t xTask )
+{
+    StackType_t * pxTopOfStack = *( StackType_t ** ) xTask;
+
+    return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+
+/*-----------------------------------------------------------*/
+
+static pthread_once_t hSigSetupThread = PTHREAD_ONCE_INIT;
+static sigset_t xTickSignal;
+static sigset_t xAllSignals;
+static struct event * pxSchedulerEndEvent;
+static volatile UBaseType_t uxCriticalNesting;
+static volatile BaseType_t xYieldPending = pdFALSE;
+static volatile BaseType_t xSchedulerEnd = pdFALSE;
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignals( void );
+static void prvSetupTimerInterrupt( void );
+static void * prvWaitForStart( void * pvParams );
+static void prvSwitchThread( Thread_t * xThreadToResume,
+                             Thread_t * xThreadToSuspend );
+static void prvSuspendSelf( Thread_t * thread );
+static void prvResumeThread( Thread_t * xThreadId );
+static void prvYield( void );
+static void vPortSystemTickHandler( int sig );
+/*-----------------------------------------------------------*/
+
+static void prvFatalError( const char * pcCall,
+                           int iErrno ) __attribute__( ( __noreturn__ ) );
+
+static void prvFatalError( const char * pcCall,
+                           int iErrno )
+{
+    fprintf( stderr, "%s: %s\n", pcCall, strerror( iErrno ) );
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     StackType_t * pxEndOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    Thread_t * thread;
+    pthread_attr_t xThreadAttributes;
+    size_t ulStackSize;
+    sigset_t xSavedMask;
+    int iRet;
+
+    ( void ) pthread_once( &hSigSetupThread, prvSetupSignals );
+
+    /*
+     * Store the additional thread data at the start of the stack.
+     */
+    thread = ( Thread_t * ) ( pxTopOfStack + 1 ) - 1;
+    pxTopOfStack = ( StackType_t * ) thread - 1;
+    ulStackSize = ( size_t ) ( pxTopOfStack + 1 - pxEndOfStack ) * sizeof( *pxTopOfStack );
+    ulStackSize &= ~( ( size_t ) 15U );
+
+    thread->pxCode = pxCode;
+    thread->pvParams = pvParameters;
+    thread->xDying = pdFALSE;
+    thread->ev = event_create();
+
+    if( thread->ev == NULL )
+    {
+        prvFatalError( "event_create", ENOMEM );
+    }
+
+    pthread_attr_init( &xThreadAttributes );
+    iRet = pthread_attr_setstack( &xThreadAttributes, pxEndOfStack, ulStackSize );
+
+    if( iRet != 0 )
+    {
+        fprintf( stderr, "[WARN] pthread_attr_setstack failed with return value: %d. Default stack will be used.\n", iRet );
+        fprintf( stderr, "[WARN] Increase the stack size to PTHREAD_STACK_MIN.\n" );
+    }
+
+    /* The new thread inherits this mask: it must not take the tick while
+     * it waits to be started. */
+    pthread_sigmask( SIG_SETMASK, &xAllSignals, &xSavedMask );
+    iRet = pthread_create( &thread->pthread, &xThreadAttributes, prvWaitForStart, thread );
+    pthread_sigmask( SIG_SETMASK, &xSavedMask, NULL );
+
+    if( iRet != 0 )
+    {
+        prvFatalError( "pthread_create", iRet );
+    }
+
+    pthread_attr_destroy( &xThreadAttributes );
+
+    return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+    struct itimerval itimer;
+
+    ( void ) pthread_once( &hSigSetupThread, prvSetupSignals );
+
+    /* vTaskStartScheduler() has already masked the tick in this thread;
+     * from here on it only waits for vPortEndScheduler(). */
+    uxCriticalNesting = 0;
+    xYieldPending = pdFALSE;
+
+    prvSetupTimerInterrupt();
+
+    /* Start the first task. */
+    prvResumeThread( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ) );
+
+    while( xSchedulerEnd == pdFALSE )
+    {
+        ( void ) event_wait( pxSchedulerEndEvent );
+    }
+
+    /* Stop the timer. */
+    memset( &itimer, 0, sizeof( itimer ) );
+    ( void ) setitimer( ITIMER_REAL, &itimer, NULL );
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+    struct itimerval itimer;
+
+    memset( &itimer, 0, sizeof( itimer ) );
+    ( void ) setitimer( ITIMER_REAL, &itimer, NULL );
+
+    xSchedulerEnd = pdTRUE;
+    event_signal( pxSchedulerEndEvent );
+
+    /* The calling task never runs again; its thread stays parked. */
+    vPortDisableInterrupts();
+
+    for( ; ; )
+    {
+        prvSuspendSelf( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ) );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    vPortDisableInterrupts();
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    uxCriticalNesting--;
+
+    if( uxCriticalNesting == 0 )
+    {
+        vPortEnableInterrupts();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTickMasked( void )
+{
+    sigset_t xCurrent;
+
+    pthread_sigmask( SIG_BLOCK, NULL, &xCurrent );
+    return ( sigismember( &xCurrent, SIG_TICK ) == 1 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    if( prvTickMasked() != pdFALSE )
+    {
+        /* Taken when the tick is unmasked (vPortEnableInterrupts). */
+        xYieldPending = pdTRUE;
+    }
+    else
+    {
+        prvYield();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+    pthread_sigmask( SIG_BLOCK, &xTickSignal, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+    pthread_sigmask( SIG_UNBLOCK, &xTickSignal, NULL );
+
+    if( xYieldPending != pdFALSE )
+    {
+        prvYield();
+    }
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortSetInterruptMask( void )
+{
+    sigset_t xPrevious;
+
+    pthread_sigmask( SIG_BLOCK, &xTickSignal, &xPrevious );
+
+    /* pdTRUE: the tick was already masked. */
+    return ( sigismember( &xPrevious, SIG_TICK ) == 1 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( BaseType_t xMask )
+{
+    if( xMask == pdFALSE )
+    {
+        vPortEnableInterrupts();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void )
+{
+    struct itimerval itimer;
+
+    /* Initialise the structure with the current timer information. */
+    if( getitimer( ITIMER_REAL, &itimer ) != 0 )
+    {
+        prvFatalError( "getitimer", errno );
+    }
+
+    /* Set the interval between timer events. */
+    itimer.it_interval.tv_sec = 0;
+    itimer.it_interval.tv_usec = portTICK_RATE_MICROSECONDS;
+
+    /* Set the current count-down. */
+    itimer.it_value.tv_sec = 0;
+    itimer.it_value.tv_usec = portTICK_RATE_MICROSECONDS;
+
+    /* Set-up the timer interrupt. */
+    if( setitimer( ITIMER_REAL, &itimer, NULL ) != 0 )
+    {
+        prvFatalError( "setitimer", errno );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void vPortSystemTickHandler( int sig )
+{
+    Thread_t * pxThreadToSuspend;
+    Thread_t * pxThreadToResume;
+    BaseType_t xSwitchRequired;
+    int iSavedErrno = errno;
+
+    ( void ) sig;
+
+    /* SIG_TICK is blocked while the handler runs. Count it as a critical
+     * section too, so a kernel call that enters and leaves one does not
+     * unmask the tick inside its own handler. */
+    uxCriticalNesting++;
+    xSwitchRequired = xTaskIncrementTick();
+    uxCriticalNesting--;
+
+    if( ( xSwitchRequired != pdFALSE ) || ( xYieldPending != pdFALSE ) )
+    {
+        xYieldPending = pdFALSE;
+        pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        vTaskSwitchContext();
+        pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+    }
+
+    errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+static void prvYield( void )
+{
+    Thread_t * pxThreadToSuspend;
+    Thread_t * pxThreadToResume;
+    sigset_t xSavedMask;
+
+    pthread_sigmask( SIG_BLOCK, &xTickSignal, &xSavedMask );
+
+    xYieldPending = pdFALSE;
+    pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+    vTaskSwitchContext();
+    pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+    prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+
+    pthread_sigmask( SIG_SETMASK, &xSavedMask, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void * pxTaskToDelete,
+                       volatile BaseType_t * pxPendYield )
+{
+    Thread_t * pxThread = prvGetThreadFromTask( pxTaskToDelete );
+
+    ( void ) pxPendYield;
+
+    pxThread->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void * pxTaskToDelete )
+{
+    Thread_t * pxThreadToCancel = prvGetThreadFromTask( pxTaskToDelete );
+
+    /* A task that deleted itself has exited already (prvSwitchThread);
+     * any other is parked in event_wait(), a cancellation point. */
+    if( pxThreadToCancel->xDying == pdFALSE )
+    {
+        pxThreadToCancel->xDying = pdTRUE;
+        pthread_cancel( pxThreadToCancel->pthread );
+    }
+
+    pthread_join( pxThreadToCancel->pthread, NULL );
+    event_delete( pxThreadToCancel->ev );
+}
+/*-----------------------------------------------------------*/
+
+static void * prvWaitForStart( void * pvParams )
+{
+    Thread_t * pxThread = pvParams;
+
+    prvSuspendSelf( pxThread );
+
+    /* Resumed for the first time: take the tick from now on. */
+    pthread_sigmask( SIG_UNBLOCK, &xTickSignal, NULL );
+
+    /* Call the task's entry point. */
+    pxThread->pxCode( pxThread->pvParams );
+
+    /* A function that implements a task must not exit or attempt to return to
+     * its caller as there is nothing to return to. If a task wants to exit it
+     * should instead call vTaskDelete( NULL ). Delete it here as a precaution. */
+    vTaskDelete( NULL );
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+/* Called with the tick masked. */
+static void prvSwitchThread( Thread_t * pxThreadToResume,
+                             Thread_t * pxThreadToSuspend )
+{
+    if( pxThreadToSuspend != pxThreadToResume )
+    {
+        /* Switch tasks.
+         *
+         * The critical section nesting is per-task, so save it on the
+         * stack of the current task (thread). */
+        UBaseType_t uxSavedCriticalNesting = uxCriticalNesting;
+
+        prvResumeThread( pxThreadToResume );
+
+        if( pxThreadToSuspend->xDying == pdTRUE )
+        {
+            pthread_exit( NULL );
+        }
+
+        prvSuspendSelf( pxThreadToSuspend );
+
+        uxCriticalNesting = uxSavedCriticalNesting;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t * thread )
+{
+    /*
+     * Suspend this thread by waiting for its event to be signalled by
+     * prvResumeThread().
+     */
+    ( void ) event_wait( thread->ev );
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeThread( Thread_t * xThreadId )
+{
+    event_signal( xThreadId->ev );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignals( void )
+{
+    struct sigaction sigtick;
+
+    sigemptyset( &xTickSignal );
+    sigaddset( &xTickSignal, SIG_TICK );
+    sigfillset( &xAllSignals );
+
+    /* Don't block SIGINT so this can be used to break into GDB while
+     * in a critical section. */
+    sigdelset( &xAllSignals, SIGINT );
+
+    pxSchedulerEndEvent = event_create();
+
+    if( pxSchedulerEndEvent == NULL )
+    {
+        prvFatalError( "event_create", ENOMEM );
+    }
+
+    memset( &sigtick, 0, sizeof( sigtick ) );
+    sigtick.sa_flags = SA_RESTART;
+    sigtick.sa_handler = vPortSystemTickHandler;
+    sigfillset( &sigtick.sa_mask );
+
+    if( sigaction( SIG_TICK, &sigtick, NULL ) != 0 )
+    {
+        prvFatalError( "sigaction", errno );
+    }
+}
+/*-----------------------------------------------------------*/
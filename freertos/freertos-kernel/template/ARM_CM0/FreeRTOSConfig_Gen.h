@@ -42,7 +42,14 @@
  *----------------------------------------------------------*/
 
 #define configUSE_PREEMPTION                    1
-#define configUSE_TICKLESS_IDLE                 0
+/* Tickless idle on LPTMR with VLPS/WAIT, source/low_power.c. Short waits
+ * (ADC conversions, mutex timeouts) keep the tick. */
+#define configUSE_TICKLESS_IDLE                 2
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP   4
+#if !defined(__ASSEMBLER__) && !defined(__IAR_SYSTEMS_ASM__)
+extern void LowPower_SuppressTicksAndSleep(uint32_t expectedIdleTicks);
+#endif
+#define portSUPPRESS_TICKS_AND_SLEEP(x)         LowPower_SuppressTicksAndSleep(x)
 #define configCPU_CLOCK_HZ                      (SystemCoreClock)
 #define configTICK_RATE_HZ                      ((TickType_t)200)
 #define configMAX_PRIORITIES                    5
@@ -56,7 +63,7 @@
 #define configUSE_COUNTING_SEMAPHORES           1
 #define configUSE_ALTERNATIVE_API               0 /* Deprecated! */
 #define configQUEUE_REGISTRY_SIZE               8
-#define configUSE_QUEUE_SETS                    0
+#define configUSE_QUEUE_SETS                    1
 #define configUSE_TIME_SLICING                  1
 #define configUSE_NEWLIB_REENTRANT              0
 #define configENABLE_BACKWARD_COMPATIBILITY     1
@@ -64,23 +71,51 @@
 #define configUSE_APPLICATION_TASK_TAG          0
 
 /* Memory allocation related definitions. */
-#define configSUPPORT_STATIC_ALLOCATION         0
-#define configSUPPORT_DYNAMIC_ALLOCATION        1
-#define configTOTAL_HEAP_SIZE                   ((size_t)(10240))
+/* All kernel objects come from source/rtos_objects.h; there is no heap. */
+#define configSUPPORT_STATIC_ALLOCATION         1
+#define configSUPPORT_DYNAMIC_ALLOCATION        0
 #define configAPPLICATION_ALLOCATED_HEAP        0
 
 /* Hook function related definitions. */
 #define configUSE_IDLE_HOOK                     0
 #define configUSE_TICK_HOOK                     0
+/* Debug builds paint stacks and check the pattern at every switch
+ * (vApplicationStackOverflowHook in source/stack_monitor.c). */
+#if defined(DEBUG)
+#define configCHECK_FOR_STACK_OVERFLOW          2
+#else
 #define configCHECK_FOR_STACK_OVERFLOW          0
+#endif
 #define configUSE_MALLOC_FAILED_HOOK            0
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
 /* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           0
+#define configGENERATE_RUN_TIME_STATS           1
 #define configUSE_TRACE_FACILITY                1
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* Run-time stats counter: PIT lifetime timer at 10x the tick rate,
+ * see source/runtime_clock.c. */
+#if !defined(__ASSEMBLER__) && !defined(__IAR_SYSTEMS_ASM__)
+extern void RuntimeClock_Init(void);
+extern uint32_t RuntimeClock_Ticks(void);
+#endif
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()  RuntimeClock_Init()
+#define portGET_RUN_TIME_COUNTER_VALUE()          RuntimeClock_Ticks()
+
+/* Binary trace recorder on the kernel trace hooks, source/trace_recorder.h.
+ * Off in the benchmark build, where it would add to every measured path. */
+#ifndef configUSE_TRACE_RECORDER
+#if defined(RTOS_BENCH)
+#define configUSE_TRACE_RECORDER                0
+#else
+#define configUSE_TRACE_RECORDER                1
+#endif
+#endif
+#if !defined(__ASSEMBLER__) && !defined(__IAR_SYSTEMS_ASM__)
+#include "trace_recorder.h"
+#endif
+
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES                   0
 #define configMAX_CO_ROUTINE_PRIORITIES         2
@@ -91,8 +126,9 @@
 #define configTIMER_QUEUE_LENGTH                10
 #define configTIMER_TASK_STACK_DEPTH            (configMINIMAL_STACK_SIZE * 2)
 
-/* Define to trap errors during development. */
-#define configASSERT(x) if((x) == 0) {taskDISABLE_INTERRUPTS(); for (;;);}
+/* Define to trap errors during development. The trace ring is dumped first
+ * when the recorder is on. */
+#define configASSERT(x) if((x) == 0) {taskDISABLE_INTERRUPTS(); TRACE_RECORDER_FAULT("assert"); for (;;);}
 
 /* Optional functions - most linkers will remove unused functions anyway. */
 #define INCLUDE_vTaskPrioritySet                1
@@ -103,13 +139,14 @@
 #define INCLUDE_vTaskDelay                      1
 #define INCLUDE_xTaskGetSchedulerState          1
 #define INCLUDE_xTaskGetCurrentTaskHandle       1
-#define INCLUDE_uxTaskGetStackHighWaterMark     0
-#define INCLUDE_xTaskGetIdleTaskHandle          0
+#define INCLUDE_uxTaskGetStackHighWaterMark     1
+#define INCLUDE_xTaskGetIdleTaskHandle          1
 #define INCLUDE_eTaskGetState                   0
 #define INCLUDE_xTimerPendFunctionCall          1
 #define INCLUDE_xTaskAbortDelay                 0
 #define INCLUDE_xTaskGetHandle                  0
 #define INCLUDE_xTaskResumeFromISR              1
+#define INCLUDE_xSemaphoreGetMutexHolder        1   /* mutex_profile.c */
 
 /* Definitions that map the FreeRTOS port interrupt handlers to their CMSIS
 standard names. */
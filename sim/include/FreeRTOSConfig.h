@@ -0,0 +1,56 @@
+/*
+ * @file    FreeRTOSConfig.h
+ * @brief   Kernel configuration for the host simulation (FreeRTOS POSIX port)
+ *
+ * Starts from the target configuration so tick rate, priorities, static
+ * allocation and the optional features match the firmware, then replaces
+ * the Cortex-M0+ specific parts.
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+
+extern uint32_t SystemCoreClock;
+
+// The trace recorder reads IPSR and writes LPUART0; neither exists here.
+#define configUSE_TRACE_RECORDER                0
+
+#include "FreeRTOSConfig_Gen.h"
+
+// No LPTMR/VLPS: the host idles in the POSIX port's own wait.
+#undef configUSE_TICKLESS_IDLE
+#define configUSE_TICKLESS_IDLE                 0
+#undef portSUPPRESS_TICKS_AND_SLEEP
+
+// Tasks run on pthreads; a stack below PTHREAD_STACK_MIN would be refused,
+// so every table entry (configMINIMAL_STACK_SIZE + n) gets host headroom.
+// The sizes in rtos_objects.h and STACK reports mean nothing here.
+#undef configMINIMAL_STACK_SIZE
+#define configMINIMAL_STACK_SIZE                ((unsigned short)4096)
+#undef configCHECK_FOR_STACK_OVERFLOW
+#define configCHECK_FOR_STACK_OVERFLOW          0
+
+// One extra level on top for the simulated interrupt controller
+// (sim_hw.c), so "ISRs" are never preempted by a task. The timer task
+// keeps the priority it has on target.
+#undef configMAX_PRIORITIES
+#define configMAX_PRIORITIES                    6
+#undef configTIMER_TASK_PRIORITY
+#define configTIMER_TASK_PRIORITY               4
+#define SIM_IRQ_TASK_PRIORITY                   (configMAX_PRIORITIES - 1)
+
+// sim_platform.c: SysTick->VAL counts from the last tick.
+#undef configUSE_TICK_HOOK
+#define configUSE_TICK_HOOK                     1
+
+#undef configASSERT
+extern void Sim_AssertFailed(const char *file, int line);
+#define configASSERT(x) if ((x) == 0) { Sim_AssertFailed(__FILE__, __LINE__); }
+
+#undef vPortSVCHandler
+#undef xPortPendSVHandler
+#undef xPortSysTickHandler
+
+#endif /* FREERTOS_CONFIG_H */
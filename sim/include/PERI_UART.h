@@ -0,0 +1,33 @@
+/*
+ * @file    PERI_UART.h
+ * @brief   UART register layout for the simulation build
+ *
+ * Same bit definitions as device/periph2/PERI_UART.h, but D is 16 bits
+ * wide. The model parks 0x01 in the upper byte; a firmware write to D
+ * (an 8-bit value) clears it, which is how sim_hw.c sees every byte sent,
+ * including repeats. Reads into a char still return the received byte.
+ */
+
+#ifndef SIM_PERI_UART_H_
+#define SIM_PERI_UART_H_
+
+#define UART_Type SimVendorUART_Type
+#include "../../device/periph2/PERI_UART.h"
+#undef UART_Type
+
+typedef struct {
+    __IO uint8_t BDH;
+    __IO uint8_t BDL;
+    __IO uint8_t C1;
+    __IO uint8_t C2;
+    __I  uint8_t S1;
+    __IO uint8_t S2;
+    __IO uint8_t C3;
+    __IO uint16_t D;
+    __IO uint8_t MA1;
+    __IO uint8_t MA2;
+    __IO uint8_t C4;
+    __IO uint8_t C5;
+} UART_Type;
+
+#endif /* SIM_PERI_UART_H_ */
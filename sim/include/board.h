@@ -0,0 +1,16 @@
+/*
+ * @file    board.h
+ * @brief   Board hooks for the simulation build
+ */
+
+#ifndef SIM_BOARD_H_
+#define SIM_BOARD_H_
+
+#include "clock_config.h"
+#include "fsl_common.h"
+
+#define BOARD_NAME "FRDM-MCXC444 (host simulation)"
+
+void BOARD_InitDebugConsole(void);
+
+#endif /* SIM_BOARD_H_ */
@@ -0,0 +1,8 @@
+#ifndef SIM_CLOCK_CONFIG_H_
+#define SIM_CLOCK_CONFIG_H_
+
+#define BOARD_BOOTCLOCKRUN_CORE_CLOCK   48000000U
+
+void BOARD_InitBootClocks(void);
+
+#endif /* SIM_CLOCK_CONFIG_H_ */
@@ -0,0 +1,64 @@
+/*
+ * @file    core_cm0plus.h
+ * @brief   Host stand-in for the CMSIS core header (simulation build)
+ *
+ * MCXC444_COMMON.h includes this after defining IRQn_Type. Only what the
+ * firmware in source/ uses is provided: the register qualifiers, the NVIC
+ * calls (modelled in sim_hw.c), SysTick and SCB->ICSR for the deadline
+ * monitor (sim_platform.c) and no-op core intrinsics.
+ */
+
+#ifndef __CORE_CM0PLUS_H_GENERIC
+#define __CORE_CM0PLUS_H_GENERIC
+
+#include <stdint.h>
+
+// Read-only registers are plain volatile here so the models can set them.
+#define __I     volatile
+#define __O     volatile
+#define __IO    volatile
+#define __IM    volatile
+#define __OM    volatile
+#define __IOM   volatile
+
+#define __STATIC_INLINE        static inline
+#define __STATIC_FORCEINLINE   static inline
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+uint32_t NVIC_GetEnableIRQ(IRQn_Type irq);
+void NVIC_SetPendingIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+uint32_t NVIC_GetPendingIRQ(IRQn_Type irq);
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+uint32_t NVIC_GetPriority(IRQn_Type irq);
+
+// SysTick counts down from the time since the last kernel tick; the tick
+// itself is the POSIX port's timer, so PENDSTSET is never seen set.
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+    volatile uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct {
+    volatile uint32_t CPUID;
+    volatile uint32_t ICSR;
+} SCB_Type;
+
+#define SCB_ICSR_PENDSTSET_Msk   (1UL << 26U)
+
+SysTick_Type *Sim_SysTickAccess(void);
+extern SCB_Type gSimScb;
+
+#define SysTick   (Sim_SysTickAccess())
+#define SCB       (&gSimScb)
+
+static inline void __NOP(void) {}
+static inline void __DSB(void) {}
+static inline void __ISB(void) {}
+static inline void __DMB(void) {}
+static inline void __WFI(void) {}
+
+#endif /* __CORE_CM0PLUS_H_GENERIC */
@@ -0,0 +1,29 @@
+/*
+ * @file    fsl_clock.h
+ * @brief   Clock queries for the simulation build (BOARD_BootClockRUN values)
+ */
+
+#ifndef SIM_FSL_CLOCK_H_
+#define SIM_FSL_CLOCK_H_
+
+#include "fsl_common.h"
+
+typedef enum {
+    kCLOCK_CoreSysClk,
+    kCLOCK_PlatClk,
+    kCLOCK_BusClk,
+    kCLOCK_FlashClk,
+    kCLOCK_Er32kClk,
+    kCLOCK_Osc0ErClk,
+    kCLOCK_McgFixedFreqClk,
+    kCLOCK_McgInternalRefClk,
+    kCLOCK_McgFllClk,
+    kCLOCK_McgPeriphClk,
+    kCLOCK_LpoClk,
+} clock_name_t;
+
+uint32_t CLOCK_GetFreq(clock_name_t name);
+uint32_t CLOCK_GetCoreSysClkFreq(void);
+uint32_t CLOCK_GetBusClkFreq(void);
+
+#endif /* SIM_FSL_CLOCK_H_ */
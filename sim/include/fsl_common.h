@@ -0,0 +1,37 @@
+/*
+ * @file    fsl_common.h
+ * @brief   Minimal SDK common header for the simulation build
+ */
+
+#ifndef SIM_FSL_COMMON_H_
+#define SIM_FSL_COMMON_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "fsl_device_registers.h"
+
+typedef int32_t status_t;
+
+enum {
+    kStatus_Success = 0,
+    kStatus_Fail = 1,
+    kStatus_ReadOnly = 2,
+    kStatus_OutOfRange = 3,
+    kStatus_InvalidArgument = 4,
+    kStatus_Timeout = 5,
+};
+
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+// Sleeps the calling thread; the simulated core has no cycle timing.
+void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz);
+
+// As in the SDK, the clock driver comes with fsl_common.h.
+#include "fsl_clock.h"
+
+#endif /* SIM_FSL_COMMON_H_ */
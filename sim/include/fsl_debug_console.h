@@ -0,0 +1,18 @@
+/*
+ * @file    fsl_debug_console.h
+ * @brief   Debug console for the simulation build: PRINTF goes to stdout
+ */
+
+#ifndef SIM_FSL_DEBUG_CONSOLE_H_
+#define SIM_FSL_DEBUG_CONSOLE_H_
+
+#include "fsl_common.h"
+
+int Sim_ConsolePrintf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+#define PRINTF   Sim_ConsolePrintf
+
+// No log rings or LogDrain task here (source/log_console.h)
+#define DEBUG_CONSOLE_ASYNC_LOG   0U
+
+#endif /* SIM_FSL_DEBUG_CONSOLE_H_ */
@@ -0,0 +1,70 @@
+/*
+ * @file    fsl_device_registers.h
+ * @brief   Device header for the simulation build: register blocks in host RAM
+ *
+ * Types, bit masks and IRQ numbers come from device/MCXC444.h unchanged;
+ * only the peripheral base pointers are redirected to the models in
+ * sim/sim_hw.c. ADC0 and UART2 go through an access function so the model
+ * can react to the previous access (start of conversion, byte written).
+ * Peripherals not listed here keep their hardware addresses and fault if
+ * touched.
+ */
+
+#ifndef __FSL_DEVICE_REGISTERS_H__
+#define __FSL_DEVICE_REGISTERS_H__
+
+#include "MCXC444.h"
+
+extern ADC_Type gSimAdc0;
+extern UART_Type gSimUart2;
+extern TPM_Type gSimTpm[3];
+extern GPIO_Type gSimGpio[5];
+extern PORT_Type gSimPort[5];
+extern SIM_Type gSimSim;
+extern DAC_Type gSimDac0;
+extern DMA_Type gSimDma0;
+extern DMAMUX_Type gSimDmamux0;
+
+ADC_Type *Sim_Adc0Access(void);
+UART_Type *Sim_Uart2Access(void);
+
+#undef ADC0
+#define ADC0        (Sim_Adc0Access())
+#undef UART2
+#define UART2       (Sim_Uart2Access())
+#undef TPM0
+#define TPM0        (&gSimTpm[0])
+#undef TPM1
+#define TPM1        (&gSimTpm[1])
+#undef TPM2
+#define TPM2        (&gSimTpm[2])
+#undef GPIOA
+#define GPIOA       (&gSimGpio[0])
+#undef GPIOB
+#define GPIOB       (&gSimGpio[1])
+#undef GPIOC
+#define GPIOC       (&gSimGpio[2])
+#undef GPIOD
+#define GPIOD       (&gSimGpio[3])
+#undef GPIOE
+#define GPIOE       (&gSimGpio[4])
+#undef PORTA
+#define PORTA       (&gSimPort[0])
+#undef PORTB
+#define PORTB       (&gSimPort[1])
+#undef PORTC
+#define PORTC       (&gSimPort[2])
+#undef PORTD
+#define PORTD       (&gSimPort[3])
+#undef PORTE
+#define PORTE       (&gSimPort[4])
+#undef SIM
+#define SIM         (&gSimSim)
+#undef DAC0
+#define DAC0        (&gSimDac0)
+#undef DMA0
+#define DMA0        (&gSimDma0)
+#undef DMAMUX0
+#define DMAMUX0     (&gSimDmamux0)
+
+#endif /* __FSL_DEVICE_REGISTERS_H__ */
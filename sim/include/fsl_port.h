@@ -0,0 +1,11 @@
+/*
+ * @file    fsl_port.h
+ * @brief   Simulation build: pin muxing is done through PORTx->PCR directly
+ */
+
+#ifndef SIM_FSL_PORT_H_
+#define SIM_FSL_PORT_H_
+
+#include "fsl_common.h"
+
+#endif /* SIM_FSL_PORT_H_ */
@@ -0,0 +1,6 @@
+#ifndef SIM_PERIPHERALS_H_
+#define SIM_PERIPHERALS_H_
+
+void BOARD_InitBootPeripherals(void);
+
+#endif /* SIM_PERIPHERALS_H_ */
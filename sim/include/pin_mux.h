@@ -0,0 +1,6 @@
+#ifndef SIM_PIN_MUX_H_
+#define SIM_PIN_MUX_H_
+
+void BOARD_InitBootPins(void);
+
+#endif /* SIM_PIN_MUX_H_ */
@@ -0,0 +1,75 @@
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Host simulation of the FRDM-MCXC444 board. The firmware in source/ is
+// compiled unchanged against register blocks in host RAM (sim/include);
+// sim_hw.c models the peripherals it uses and runs their interrupt
+// handlers, sim_esp32.c stands in for the ESP32 on UART2.
+
+/* -------------------- RUN CONTROL / OUTPUT -------------------- */
+// Simulated milliseconds since the scheduler started (kernel tick count).
+uint32_t Sim_NowMs(void);
+
+// "SIM <ms> ..." line on stdout. Every log line, console line and UART
+// line is also matched against the script's expectations.
+void Sim_Log(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+void Sim_AssertFailed(const char *file, int line);
+
+// Called from the IRQ task once per tick: deadlines and end of run.
+void Sim_Step(uint32_t nowMs);
+
+// Script expectation: some output line must contain text by byMs.
+void SimCheck_Add(uint32_t byMs, const char *text);
+void SimCheck_Line(const char *line);
+void Sim_SetEndMs(uint32_t ms);
+
+/* -------------------- WAVEFORMS -------------------- */
+typedef enum {
+    SIM_WAVE_CONST = 0,
+    SIM_WAVE_SINE,
+    SIM_WAVE_SQUARE,
+    SIM_WAVE_RAMP,
+    SIM_WAVE_TABLE,
+} SimWaveKind_t;
+
+// const:V | sine:MID:AMP:PERIOD_MS | square:LO:HI:PERIOD_MS |
+// ramp:FROM:TO:DURATION_MS | file:PATH ("<ms> <value>" or "<ms>,<value>"
+// per line, linear in between, last value held). A bare number is const.
+// Times are relative to startMs.
+typedef struct {
+    SimWaveKind_t kind;
+    float a, b, c;
+    uint32_t startMs;        // time 0 of the shape
+    uint16_t points;
+    uint32_t *pointMs;       // SIM_WAVE_TABLE only
+    float *pointValue;
+} SimWave_t;
+
+bool SimWave_Parse(SimWave_t *wave, const char *spec, uint32_t startMs);
+float SimWave_Value(const SimWave_t *wave, uint32_t nowMs);
+
+/* -------------------- PERIPHERAL MODELS -------------------- */
+void SimHw_Init(void);
+// Creates the IRQ task; call before the firmware starts the scheduler.
+void SimHw_Start(void);
+void SimHw_SetAdcWave(uint8_t channel, const SimWave_t *wave);
+// Bytes from the ESP32 side, delivered at the programmed baud rate.
+void SimHw_UartInject(const char *data, size_t len);
+// DAC samples written by DMA are appended to a 16-bit mono WAV file.
+bool SimHw_OpenWav(const char *path);
+void SimHw_Finish(void);
+
+/* -------------------- ESP32 SIDE OF UART2 -------------------- */
+void SimEsp32_Init(void);
+bool SimEsp32_LoadScript(const char *path);
+void SimEsp32_SetDht(const SimWave_t *temperature, const SimWave_t *humidity);
+// UART2 on a pseudo-terminal instead of the scripted stand-in.
+bool SimEsp32_OpenPty(void);
+void SimEsp32_OnMcuByte(uint8_t byte);
+void SimEsp32_Step(uint32_t nowMs);
+
+#endif /* SIM_H_ */
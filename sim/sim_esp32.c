@@ -0,0 +1,274 @@
+/*
+ * @file    sim_esp32.c
+ * @brief   ESP32 stand-in on the simulated UART2
+ *
+ * Default: answers GET_DHT the way esp.ino does, from the temperature and
+ * humidity waveforms, and replays a script of commands and expectations.
+ * With --pty the UART is exposed on a pseudo-terminal instead, so a real
+ * ESP32 (through a USB-serial adapter and socat) or a terminal can talk to
+ * the firmware.
+ */
+
+#define _XOPEN_SOURCE 600
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sim.h"
+
+#define ESP_LINE_LEN        256u
+#define ESP_REPLY_DELAY_MS  30u     // DHT read + JSON on the real board
+#define ESP_MAX_STEPS       256u
+
+typedef enum {
+    STEP_SEND = 0,
+    STEP_EXPECT,
+    STEP_ADC,
+    STEP_TEMP,
+    STEP_HUM,
+    STEP_END,
+} StepKind_t;
+
+typedef struct {
+    uint32_t atMs;
+    StepKind_t kind;
+    uint8_t channel;
+    char text[ESP_LINE_LEN];
+} ScriptStep_t;
+
+static ScriptStep_t steps[ESP_MAX_STEPS];
+static uint32_t stepCount;
+static uint32_t nextStep;
+
+static SimWave_t tempWave;
+static SimWave_t humWave;
+static uint32_t dhtReplyAt;         // 0 = none pending
+
+static char lineBuf[ESP_LINE_LEN];
+static uint32_t lineLen;
+static int ptyFd = -1;
+
+void SimEsp32_Init(void) {
+    (void)SimWave_Parse(&tempWave, "25", 0u);
+    (void)SimWave_Parse(&humWave, "60", 0u);
+}
+
+void SimEsp32_SetDht(const SimWave_t *temperature, const SimWave_t *humidity) {
+    if (temperature != NULL) tempWave = *temperature;
+    if (humidity != NULL) humWave = *humidity;
+}
+
+static void send_line(const char *text) {
+    char buf[ESP_LINE_LEN + 2u];
+    int n = snprintf(buf, sizeof(buf), "%s\n", text);
+    if (n > 0) {
+        SimHw_UartInject(buf, (size_t)n);
+    }
+}
+
+/* -------------------- SCRIPT -------------------- */
+// One step per line: "<ms> send <line>", "<ms> expect <text>" (some output
+// line contains text by ms), "<ms> adc <ch> <wave>", "<ms> temp <wave>",
+// "<ms> hum <wave>", "<ms> dht <T> <H>", "<ms> end". '#' starts a comment.
+// Returns the number of steps written to out (dht gives two), 0 on error.
+static uint32_t parse_step(const char *line, ScriptStep_t out[2], const char *path, unsigned lineNo) {
+    unsigned long ms;
+    char verb[16];
+    int used = 0;
+    if (sscanf(line, "%lu %15s %n", &ms, verb, &used) < 2) {
+        fprintf(stderr, "sim: %s:%u: expected \"<ms> <verb> ...\"\n", path, lineNo);
+        return 0u;
+    }
+    const char *arg = line + used;
+    uint32_t count = 1u;
+    ScriptStep_t *s = &out[0];
+    memset(out, 0, 2u * sizeof(*out));
+    s->atMs = (uint32_t)ms;
+    snprintf(s->text, sizeof(s->text), "%s", arg);
+
+    if (strcmp(verb, "send") == 0) {
+        s->kind = STEP_SEND;
+    } else if (strcmp(verb, "expect") == 0) {
+        s->kind = STEP_EXPECT;
+    } else if (strcmp(verb, "adc") == 0) {
+        unsigned ch;
+        int n = 0;
+        if (sscanf(arg, "%u %n", &ch, &n) < 1 || ch > 31u) {
+            fprintf(stderr, "sim: %s:%u: adc <channel> <wave>\n", path, lineNo);
+            return 0u;
+        }
+        s->kind = STEP_ADC;
+        s->channel = (uint8_t)ch;
+        snprintf(s->text, sizeof(s->text), "%s", arg + n);
+    } else if (strcmp(verb, "temp") == 0) {
+        s->kind = STEP_TEMP;
+    } else if (strcmp(verb, "hum") == 0) {
+        s->kind = STEP_HUM;
+    } else if (strcmp(verb, "dht") == 0) {
+        char t[32], h[32];
+        if (sscanf(arg, "%31s %31s", t, h) != 2) {
+            fprintf(stderr, "sim: %s:%u: dht <temp> <hum>\n", path, lineNo);
+            return 0u;
+        }
+        s->kind = STEP_TEMP;
+        snprintf(s->text, sizeof(s->text), "%s", t);
+        out[1].atMs = s->atMs;
+        out[1].kind = STEP_HUM;
+        snprintf(out[1].text, sizeof(out[1].text), "%s", h);
+        count = 2u;
+    } else if (strcmp(verb, "end") == 0) {
+        s->kind = STEP_END;
+    } else {
+        fprintf(stderr, "sim: %s:%u: unknown verb \"%s\"\n", path, lineNo, verb);
+        return 0u;
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        SimWave_t probe;
+        StepKind_t k = out[i].kind;
+        if ((k == STEP_ADC || k == STEP_TEMP || k == STEP_HUM) &&
+            !SimWave_Parse(&probe, out[i].text, out[i].atMs)) {
+            return 0u;
+        }
+    }
+    return count;
+}
+
+bool SimEsp32_LoadScript(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "sim: cannot open %s\n", path);
+        return false;
+    }
+    char line[ESP_LINE_LEN + 32u];
+    unsigned lineNo = 0;
+    uint32_t lastMs = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), f) != NULL) {
+        ScriptStep_t parsed[2];
+        lineNo++;
+        line[strcspn(line, "\r\n")] = '\0';
+        const char *p = line + strspn(line, " \t");
+        if (*p == '\0' || *p == '#') {
+            continue;
+        }
+        uint32_t n = parse_step(p, parsed, path, lineNo);
+        if (n == 0u) {
+            ok = false;
+        } else if (stepCount + n > ESP_MAX_STEPS) {
+            fprintf(stderr, "sim: %s: more than %u steps\n", path, (unsigned)ESP_MAX_STEPS);
+            ok = false;
+        } else if (parsed[0].atMs < lastMs) {
+            fprintf(stderr, "sim: %s:%u: times must not decrease\n", path, lineNo);
+            ok = false;
+        } else {
+            lastMs = parsed[0].atMs;
+            if (parsed[0].kind == STEP_EXPECT) {
+                SimCheck_Add(parsed[0].atMs, parsed[0].text);
+            } else if (parsed[0].kind == STEP_END) {
+                Sim_SetEndMs(parsed[0].atMs);
+            }
+            memcpy(&steps[stepCount], parsed, n * sizeof(parsed[0]));
+            stepCount += n;
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+static void run_step(const ScriptStep_t *s) {
+    SimWave_t wave;
+    switch (s->kind) {
+    case STEP_SEND:
+        Sim_Log("esp> %s", s->text);
+        send_line(s->text);
+        break;
+    case STEP_ADC:
+        if (SimWave_Parse(&wave, s->text, s->atMs)) {
+            SimHw_SetAdcWave(s->channel, &wave);
+            Sim_Log("adc ch%u <- %s", (unsigned)s->channel, s->text);
+        }
+        break;
+    case STEP_TEMP:
+        if (SimWave_Parse(&wave, s->text, s->atMs)) {
+            SimEsp32_SetDht(&wave, NULL);
+            Sim_Log("dht temperature <- %s", s->text);
+        }
+        break;
+    case STEP_HUM:
+        if (SimWave_Parse(&wave, s->text, s->atMs)) {
+            SimEsp32_SetDht(NULL, &wave);
+            Sim_Log("dht humidity <- %s", s->text);
+        }
+        break;
+    case STEP_EXPECT:       // registered at load time
+    case STEP_END:
+    default:
+        break;
+    }
+}
+
+/* -------------------- PSEUDO-TERMINAL -------------------- */
+bool SimEsp32_OpenPty(void) {
+    int fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0) {
+        fprintf(stderr, "sim: pty: %s\n", strerror(errno));
+        if (fd >= 0) close(fd);
+        return false;
+    }
+    ptyFd = fd;
+    printf("SIM UART2 on %s (9600 8N1 is not enforced)\n", ptsname(fd));
+    fflush(stdout);
+    return true;
+}
+
+/* -------------------- UART2 TRAFFIC -------------------- */
+static void on_mcu_line(const char *line) {
+    Sim_Log("uart> %s", line);
+    if (ptyFd < 0 && strcmp(line, "GET_DHT") == 0) {
+        dhtReplyAt = Sim_NowMs() + ESP_REPLY_DELAY_MS;
+    }
+}
+
+// Called from the UART2 model for every byte the firmware transmits.
+void SimEsp32_OnMcuByte(uint8_t byte) {
+    if (ptyFd >= 0) {
+        (void)write(ptyFd, &byte, 1);
+    }
+    if (byte == '\n' || byte == '\r') {
+        if (lineLen != 0u) {
+            lineBuf[lineLen] = '\0';
+            on_mcu_line(lineBuf);
+            lineLen = 0u;
+        }
+    } else if (lineLen + 1u < ESP_LINE_LEN) {
+        lineBuf[lineLen++] = (char)byte;
+    }
+}
+
+void SimEsp32_Step(uint32_t nowMs) {
+    while (nextStep < stepCount && steps[nextStep].atMs <= nowMs) {
+        run_step(&steps[nextStep++]);
+    }
+
+    if (dhtReplyAt != 0u && (int32_t)(nowMs - dhtReplyAt) >= 0) {
+        char reply[96];
+        dhtReplyAt = 0u;
+        snprintf(reply, sizeof(reply), "{\"temp\":%.1f,\"humidity\":%.1f}",
+                 (double)SimWave_Value(&tempWave, nowMs), (double)SimWave_Value(&humWave, nowMs));
+        Sim_Log("esp> %s", reply);
+        send_line(reply);
+    }
+
+    if (ptyFd >= 0) {
+        char buf[256];
+        ssize_t n = read(ptyFd, buf, sizeof(buf));
+        if (n > 0) {
+            SimHw_UartInject(buf, (size_t)n);
+        }
+    }
+}
@@ -0,0 +1,604 @@
+/*
+ * @file    sim_hw.c
+ * @brief   Register models for the host simulation and the IRQ task that drives them
+ *
+ * The register blocks are plain host RAM. Once per kernel tick the IRQ task
+ * (above every firmware task) advances the models by the elapsed time and
+ * calls the firmware's interrupt handlers for whatever is pending and
+ * enabled in the NVIC model, lowest priority value first. Busy-wait loops
+ * in the firmware (ADC conversion) are served immediately through the
+ * ADC0/UART2 access functions instead.
+ *
+ * Modelled: ADC0 single conversions (values from waveforms), UART2 RX and
+ * TX (TDRE/TC and their interrupts) at the programmed baud rate, TPM0-2 PWM outputs (logged on change) and DMA
+ * request pacing, GPIOA-E outputs (logged on change), DMA0 channels paced
+ * by TPM overflow, DAC0 (captured to WAV), SIM clock gates (warned when a
+ * peripheral is used ungated). Not modelled: TPM interrupts, input capture,
+ * UART edge wake-up, PIT/LPTMR/SMC (the simulation replaces runtime_clock.c
+ * and low_power.c).
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fsl_device_registers.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "sim.h"
+
+#define SIM_TPM_CLOCK_HZ     48000000u   // MCGPCLK (HIRC), TPMSRC = 1
+#define SIM_BUS_CLOCK_HZ     24000000u
+#define SIM_IRQ_COUNT        32u
+#define SIM_ADC_CHANNELS     32u
+#define SIM_UART_D_IDLE      0x0100u     // upper byte: not written since last look
+#define SIM_UART_FIFO        4096u
+#define SIM_UART_LINE        256u
+#define SIM_DMA_CHANNELS     4u
+#define SIM_DMAMUX_TPM0_OVF  54u         // TPM0..2 overflow request sources
+#define SIM_DMAMUX_ALWAYS    60u         // 60..63: always enabled
+#define SIM_IRQ_GUARD        1024u       // handler calls per pass
+
+/* -------------------- REGISTER FILES -------------------- */
+ADC_Type gSimAdc0;
+UART_Type gSimUart2;
+TPM_Type gSimTpm[3];
+GPIO_Type gSimGpio[5];
+PORT_Type gSimPort[5];
+SIM_Type gSimSim;
+DAC_Type gSimDac0;
+DMA_Type gSimDma0;
+DMAMUX_Type gSimDmamux0;
+
+/* -------------------- NVIC -------------------- */
+extern void DMA0_IRQHandler(void) __attribute__((weak));
+extern void DMA1_IRQHandler(void) __attribute__((weak));
+extern void DMA2_IRQHandler(void) __attribute__((weak));
+extern void DMA3_IRQHandler(void) __attribute__((weak));
+extern void UART2_FLEXIO_IRQHandler(void) __attribute__((weak));
+extern void ADC0_IRQHandler(void) __attribute__((weak));
+extern void TPM0_IRQHandler(void) __attribute__((weak));
+extern void TPM1_IRQHandler(void) __attribute__((weak));
+extern void TPM2_IRQHandler(void) __attribute__((weak));
+extern void PORTC_PORTD_IRQHandler(void) __attribute__((weak));
+
+static void (*const kVectors[SIM_IRQ_COUNT])(void) = {
+    [DMA0_IRQn] = DMA0_IRQHandler,
+    [DMA1_IRQn] = DMA1_IRQHandler,
+    [DMA2_IRQn] = DMA2_IRQHandler,
+    [DMA3_IRQn] = DMA3_IRQHandler,
+    [UART2_FLEXIO_IRQn] = UART2_FLEXIO_IRQHandler,
+    [ADC0_IRQn] = ADC0_IRQHandler,
+    [TPM0_IRQn] = TPM0_IRQHandler,
+    [TPM1_IRQn] = TPM1_IRQHandler,
+    [TPM2_IRQn] = TPM2_IRQHandler,
+    [PORTC_PORTD_IRQn] = PORTC_PORTD_IRQHandler,
+};
+
+static uint32_t nvicEnabled;
+static uint32_t nvicPending;
+static uint8_t nvicPriority[SIM_IRQ_COUNT];
+static uint32_t irqCount[SIM_IRQ_COUNT];
+static uint32_t warned;          // one-shot warnings, bit per kind
+
+void NVIC_EnableIRQ(IRQn_Type irq) {
+    if ((int)irq >= 0) nvicEnabled |= 1u << irq;
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq) {
+    if ((int)irq >= 0) nvicEnabled &= ~(1u << irq);
+}
+
+uint32_t NVIC_GetEnableIRQ(IRQn_Type irq) {
+    return ((int)irq >= 0) ? ((nvicEnabled >> irq) & 1u) : 0u;
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type irq) {
+    if ((int)irq >= 0) nvicPending |= 1u << irq;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq) {
+    if ((int)irq >= 0) nvicPending &= ~(1u << irq);
+}
+
+uint32_t NVIC_GetPendingIRQ(IRQn_Type irq) {
+    return ((int)irq >= 0) ? ((nvicPending >> irq) & 1u) : 0u;
+}
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) {
+    if ((int)irq >= 0) nvicPriority[irq] = (uint8_t)(priority & 0xC0u);   // 2 bits implemented
+}
+
+uint32_t NVIC_GetPriority(IRQn_Type irq) {
+    return ((int)irq >= 0) ? nvicPriority[irq] : 0u;
+}
+
+enum {
+    WARN_ADC_GATE = 1u << 0,
+    WARN_UART_GATE = 1u << 1,
+    WARN_UART_TE = 1u << 2,
+    WARN_DMA_GATE = 1u << 3,
+    WARN_NO_HANDLER = 1u << 4,
+};
+
+static void warn_once(uint32_t kind, const char *what) {
+    if ((warned & kind) == 0u) {
+        warned |= kind;
+        Sim_Log("WARN %s", what);
+    }
+}
+
+/* -------------------- ADC0 -------------------- */
+static SimWave_t adcWave[SIM_ADC_CHANNELS];
+static uint32_t adcLastSc1;
+static uint32_t adcConversions;
+
+static uint32_t adc_sample(uint32_t channel) {
+    static const uint8_t kBits[4] = { 8u, 12u, 10u, 16u };
+    uint32_t full = (1u << kBits[(gSimAdc0.CFG1 & ADC_CFG1_MODE_MASK) >> ADC_CFG1_MODE_SHIFT]) - 1u;
+    float v = (channel < SIM_ADC_CHANNELS) ? SimWave_Value(&adcWave[channel], Sim_NowMs()) : 0.0f;
+    if (v <= 0.0f) return 0u;
+    if (v >= (float)full) return full;
+    return (uint32_t)(v + 0.5f);
+}
+
+// A conversion starts whenever SC1[0] was written with a different value;
+// it completes at once. Rewriting the identical value is not seen, so the
+// result is refreshed on every access while COCO is set.
+static void adc_service(void) {
+    uint32_t sc1 = gSimAdc0.SC1[0];
+    uint32_t channel = (sc1 & ADC_SC1_ADCH_MASK) >> ADC_SC1_ADCH_SHIFT;
+    if (channel == 31u) {
+        adcLastSc1 = sc1;           // module disabled
+        return;
+    }
+    if ((sc1 & ~ADC_SC1_COCO_MASK) != (adcLastSc1 & ~ADC_SC1_COCO_MASK)) {
+        if ((gSimSim.SCGC6 & SIM_SCGC6_ADC0_MASK) == 0u) {
+            warn_once(WARN_ADC_GATE, "ADC0 used with its clock gate off (hard fault on target)");
+        }
+        gSimAdc0.R[0] = adc_sample(channel);
+        gSimAdc0.SC1[0] = sc1 | ADC_SC1_COCO_MASK;
+        adcLastSc1 = gSimAdc0.SC1[0];
+        adcConversions++;
+        if (sc1 & ADC_SC1_AIEN_MASK) {
+            nvicPending |= 1u << ADC0_IRQn;
+        }
+    } else if (sc1 & ADC_SC1_COCO_MASK) {
+        gSimAdc0.R[0] = adc_sample(channel);
+    }
+}
+
+ADC_Type *Sim_Adc0Access(void) {
+    adc_service();
+    return &gSimAdc0;
+}
+
+void SimHw_SetAdcWave(uint8_t channel, const SimWave_t *wave) {
+    if (channel < SIM_ADC_CHANNELS && wave != NULL) {
+        adcWave[channel] = *wave;
+    }
+}
+
+/* -------------------- UART2 -------------------- */
+static uint8_t rxFifo[SIM_UART_FIFO];
+static uint32_t rxHead, rxTail;
+static uint32_t rxCreditUs;
+static uint32_t txCreditUs;
+static uint8_t rxLatch;                 // last byte presented in D
+static uint32_t rxBytes, txBytes, rxDropped;
+
+static uint32_t uart_byte_us(void) {
+    uint32_t sbr = ((uint32_t)(gSimUart2.BDH & UART_BDH_SBR_MASK) << 8) | gSimUart2.BDL;
+    if (sbr == 0u) {
+        return 0u;
+    }
+    uint32_t baud = SIM_BUS_CLOCK_HZ / (16u * sbr);
+    return (baud == 0u) ? 0u : (10u * 1000000u) / baud;   // 8N1 = 10 bit times
+}
+
+static void uart_service_tx(void) {
+    uint16_t d = gSimUart2.D;
+    if ((d >> 8) != 1u) {
+        gSimUart2.D = (uint16_t)(SIM_UART_D_IDLE | rxLatch);
+        if ((gSimSim.SCGC4 & SIM_SCGC4_UART2_MASK) == 0u) {
+            warn_once(WARN_UART_GATE, "UART2 used with its clock gate off (hard fault on target)");
+        }
+        if (gSimUart2.C2 & UART_C2_TE_MASK) {
+            txBytes++;
+            SimEsp32_OnMcuByte((uint8_t)d);
+        } else {
+            warn_once(WARN_UART_TE, "UART2 byte written with the transmitter disabled");
+        }
+        // The ESP32 has the byte; TDRE/TC come back one character time later.
+        gSimUart2.S1 &= ~(UART_S1_TDRE_MASK | UART_S1_TC_MASK);
+    }
+}
+
+// Ends the character in flight once the baud rate allows it.
+static void uart_tx_ready(void) {
+    uint32_t byteUs = uart_byte_us();
+    if ((gSimUart2.S1 & UART_S1_TDRE_MASK) || txCreditUs < byteUs) {
+        return;
+    }
+    txCreditUs -= byteUs;
+    gSimUart2.S1 |= UART_S1_TDRE_MASK | UART_S1_TC_MASK;
+}
+
+UART_Type *Sim_Uart2Access(void) {
+    uart_service_tx();
+    return &gSimUart2;
+}
+
+void SimHw_UartInject(const char *data, size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        uint32_t next = (rxHead + 1u) % SIM_UART_FIFO;
+        if (next == rxTail) {
+            rxDropped++;
+            continue;
+        }
+        rxFifo[rxHead] = (uint8_t)data[i];
+        rxHead = next;
+    }
+}
+
+// Presents the next received byte once the baud rate allows it. Each byte
+// is consumed by one run of the UART2 handler (the firmware reads D there).
+static void uart_rx_present(void) {
+    uint32_t byteUs = uart_byte_us();
+    if ((gSimUart2.S1 & UART_S1_RDRF_MASK) || rxHead == rxTail || byteUs == 0u ||
+        (gSimUart2.C2 & UART_C2_RE_MASK) == 0u || rxCreditUs < byteUs) {
+        return;
+    }
+    rxCreditUs -= byteUs;
+    rxLatch = rxFifo[rxTail];
+    rxTail = (rxTail + 1u) % SIM_UART_FIFO;
+    gSimUart2.D = (uint16_t)(SIM_UART_D_IDLE | rxLatch);
+    gSimUart2.S1 |= UART_S1_RDRF_MASK;
+    rxBytes++;
+}
+
+static void uart_advance(uint32_t elapsedUs) {
+    if (rxHead == rxTail) {
+        rxCreditUs = 0u;            // idle line: no burst when data arrives
+    } else {
+        rxCreditUs += elapsedUs;
+    }
+    if (gSimUart2.S1 & UART_S1_TDRE_MASK) {
+        txCreditUs = 0u;            // transmitter idle
+    } else {
+        txCreditUs += elapsedUs;
+    }
+}
+
+/* -------------------- TPM0-2 -------------------- */
+#define SIM_TPM_CHANNELS 6u
+
+typedef struct {
+    uint32_t hz;
+    uint32_t permille;
+} SimPwmOut_t;
+
+static SimPwmOut_t pwmOut[3][SIM_TPM_CHANNELS];
+static bool dmaPacing[3];
+
+// Board wiring, for readable logs.
+static const char *const kTpmLabels[3][SIM_TPM_CHANNELS] = {
+    [0] = { "LED PTC1", "buzzer PTC2" },
+};
+
+static uint32_t tpm_overflow_hz(const TPM_Type *tpm) {
+    if ((tpm->SC & TPM_SC_CMOD_MASK) == 0u) {
+        return 0u;
+    }
+    uint32_t ps = (tpm->SC & TPM_SC_PS_MASK) >> TPM_SC_PS_SHIFT;
+    return (SIM_TPM_CLOCK_HZ >> ps) / ((tpm->MOD & 0xFFFFu) + 1u);
+}
+
+static void tpm_step(void) {
+    for (uint32_t t = 0; t < 3u; ++t) {
+        const TPM_Type *tpm = &gSimTpm[t];
+        uint32_t hz = tpm_overflow_hz(tpm);
+        uint32_t period = (tpm->MOD & 0xFFFFu) + 1u;
+
+        bool pacing = (hz != 0u) && (tpm->SC & TPM_SC_DMA_MASK);
+        if (pacing != dmaPacing[t]) {
+            dmaPacing[t] = pacing;
+            Sim_Log("TPM%u DMA pacing %s %lu Hz", (unsigned)t, pacing ? "on" : "off",
+                    (unsigned long)hz);
+        }
+
+        for (uint32_t ch = 0; ch < SIM_TPM_CHANNELS; ++ch) {
+            uint32_t cnsc = tpm->CONTROLS[ch].CnSC;
+            bool pwm = (cnsc & TPM_CnSC_MSB_MASK) && (cnsc & (TPM_CnSC_ELSB_MASK | TPM_CnSC_ELSA_MASK));
+            SimPwmOut_t now = { 0u, 0u };
+            if (pwm && hz != 0u) {
+                uint32_t cnv = tpm->CONTROLS[ch].CnV & 0xFFFFu;
+                now.hz = hz;
+                now.permille = (cnv >= period) ? 1000u : (cnv * 1000u) / period;
+                if (cnsc & TPM_CnSC_ELSA_MASK) {
+                    now.permille = 1000u - now.permille;    // low-true
+                }
+            }
+            if (now.hz != pwmOut[t][ch].hz || now.permille != pwmOut[t][ch].permille) {
+                const char *label = kTpmLabels[t][ch];
+                Sim_Log("TPM%u.%u%s%s %lu Hz %u.%u%%", (unsigned)t, (unsigned)ch,
+                        label ? " " : "", label ? label : "", (unsigned long)now.hz,
+                        (unsigned)(now.permille / 10u), (unsigned)(now.permille % 10u));
+                pwmOut[t][ch] = now;
+            }
+        }
+    }
+}
+
+/* -------------------- GPIOA-E -------------------- */
+static uint32_t gpioLastOut[5];
+static uint32_t gpioLastDir[5];
+
+static void gpio_step(void) {
+    for (uint32_t p = 0; p < 5u; ++p) {
+        GPIO_Type *g = &gSimGpio[p];
+        if (g->PSOR) { g->PDOR |= g->PSOR;  g->PSOR = 0u; }
+        if (g->PCOR) { g->PDOR &= ~g->PCOR; g->PCOR = 0u; }
+        if (g->PTOR) { g->PDOR ^= g->PTOR;  g->PTOR = 0u; }
+        g->PDIR = (g->PDIR & ~g->PDDR) | (g->PDOR & g->PDDR);
+
+        uint32_t out = g->PDOR & g->PDDR;
+        uint32_t changed = (out ^ gpioLastOut[p]) | (g->PDDR & ~gpioLastDir[p]);
+        for (uint32_t pin = 0; changed != 0u && pin < 32u; ++pin) {
+            if (changed & (1u << pin)) {
+                Sim_Log("GPIO%c%u = %u", 'A' + (int)p, (unsigned)pin, (unsigned)((out >> pin) & 1u));
+                changed &= ~(1u << pin);
+            }
+        }
+        gpioLastOut[p] = out;
+        gpioLastDir[p] = g->PDDR;
+    }
+}
+
+/* -------------------- DMA0 / DAC0 -------------------- */
+static uint64_t dmaAccum[SIM_DMA_CHANNELS];   // request-rate x microseconds
+static uint32_t dmaTransfers;
+
+static FILE *wavFile;
+static uint32_t wavSamples;
+static uint32_t wavRate;
+
+static void wav_put32(uint32_t v) {
+    uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) };
+    fwrite(b, 1, 4, wavFile);
+}
+
+static void wav_put16(uint16_t v) {
+    uint8_t b[2] = { (uint8_t)v, (uint8_t)(v >> 8) };
+    fwrite(b, 1, 2, wavFile);
+}
+
+static void wav_header(void) {
+    fseek(wavFile, 0, SEEK_SET);
+    fwrite("RIFF", 1, 4, wavFile);
+    wav_put32(36u + wavSamples * 2u);
+    fwrite("WAVEfmt ", 1, 8, wavFile);
+    wav_put32(16u);
+    wav_put16(1u);                  // PCM
+    wav_put16(1u);                  // mono
+    wav_put32(wavRate);
+    wav_put32(wavRate * 2u);
+    wav_put16(2u);
+    wav_put16(16u);
+    fwrite("data", 1, 4, wavFile);
+    wav_put32(wavSamples * 2u);
+    fseek(wavFile, 0, SEEK_END);
+}
+
+bool SimHw_OpenWav(const char *path) {
+    wavFile = fopen(path, "w+b");
+    if (wavFile == NULL) {
+        return false;
+    }
+    wavRate = 8000u;
+    wav_header();
+    return true;
+}
+
+static void dac_capture(uint32_t rateHz) {
+    if (wavFile == NULL) {
+        return;
+    }
+    if (wavSamples == 0u && rateHz != 0u) {
+        wavRate = rateHz;
+    }
+    uint32_t code = ((uint32_t)gSimDac0.DAT[0].DATH << 8 | gSimDac0.DAT[0].DATL) & 0xFFFu;
+    wav_put16((uint16_t)(int16_t)(((int32_t)code - 2048) * 16));
+    wavSamples++;
+}
+
+static uint32_t dma_request_hz(uint32_t ch) {
+    uint8_t mux = gSimDmamux0.CHCFG[ch];
+    if ((mux & DMAMUX_CHCFG_ENBL_MASK) == 0u) {
+        return 0u;
+    }
+    uint32_t source = (mux & DMAMUX_CHCFG_SOURCE_MASK) >> DMAMUX_CHCFG_SOURCE_SHIFT;
+    if (source >= SIM_DMAMUX_TPM0_OVF && source < SIM_DMAMUX_TPM0_OVF + 3u) {
+        const TPM_Type *tpm = &gSimTpm[source - SIM_DMAMUX_TPM0_OVF];
+        return (tpm->SC & TPM_SC_DMA_MASK) ? tpm_overflow_hz(tpm) : 0u;
+    }
+    if (source >= SIM_DMAMUX_ALWAYS) {
+        return 1000000000u;          // as fast as the model can go
+    }
+    return 0u;
+}
+
+static uint32_t dma_size(uint32_t field) {
+    return (field == 1u) ? 1u : (field == 2u) ? 2u : 4u;   // 00 = 32-bit
+}
+
+static void dma_step(uint32_t elapsedUs) {
+    for (uint32_t ch = 0; ch < SIM_DMA_CHANNELS; ++ch) {
+        uint32_t dcr = gSimDma0.DMA[ch].DCR;
+        uint32_t hz = dma_request_hz(ch);
+        if ((dcr & DMA_DCR_ERQ_MASK) == 0u || hz == 0u) {
+            dmaAccum[ch] = 0u;
+            continue;
+        }
+        if ((gSimSim.SCGC7 & SIM_SCGC7_DMA_MASK) == 0u) {
+            warn_once(WARN_DMA_GATE, "DMA used with its clock gate off (hard fault on target)");
+        }
+        dmaAccum[ch] += (uint64_t)elapsedUs * hz;
+        uint32_t requests = (uint32_t)(dmaAccum[ch] / 1000000u);
+        dmaAccum[ch] %= 1000000u;
+
+        uint32_t ssize = dma_size((dcr & DMA_DCR_SSIZE_MASK) >> DMA_DCR_SSIZE_SHIFT);
+        uint32_t dsize = dma_size((dcr & DMA_DCR_DSIZE_MASK) >> DMA_DCR_DSIZE_SHIFT);
+        while (requests-- > 0u) {
+            uint32_t bcr = gSimDma0.DMA[ch].DSR_BCR & DMA_DSR_BCR_BCR_MASK;
+            if (bcr == 0u) {
+                break;
+            }
+            uint32_t value = 0u;
+            memcpy(&value, (const void *)(uintptr_t)gSimDma0.DMA[ch].SAR, ssize);
+            memcpy((void *)(uintptr_t)gSimDma0.DMA[ch].DAR, &value, dsize);
+            uintptr_t dar = gSimDma0.DMA[ch].DAR;
+            if (dcr & DMA_DCR_SINC_MASK) gSimDma0.DMA[ch].SAR += ssize;
+            if (dcr & DMA_DCR_DINC_MASK) gSimDma0.DMA[ch].DAR += dsize;
+            dmaTransfers++;
+            if (dar >= (uintptr_t)&gSimDac0 && dar < (uintptr_t)(&gSimDac0 + 1)) {
+                dac_capture(hz);
+            }
+
+            bcr = (bcr > ssize) ? bcr - ssize : 0u;
+            if (bcr != 0u) {
+                gSimDma0.DMA[ch].DSR_BCR = DMA_DSR_BCR_BSY_MASK | bcr;
+                continue;
+            }
+            gSimDma0.DMA[ch].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+            if (dcr & DMA_DCR_D_REQ_MASK) {
+                gSimDma0.DMA[ch].DCR &= ~DMA_DCR_ERQ_MASK;
+            }
+            if (dcr & DMA_DCR_EINT_MASK) {
+                nvicPending |= 1u << (DMA0_IRQn + ch);
+            }
+            break;
+        }
+    }
+}
+
+/* -------------------- IRQ TASK -------------------- */
+static void dispatch_irqs(void) {
+    for (uint32_t guard = 0; guard < SIM_IRQ_GUARD; ++guard) {
+        uart_service_tx();
+        uart_tx_ready();
+        uart_rx_present();
+        uint32_t pending = nvicPending;
+        uint8_t s1 = gSimUart2.S1;
+        uint8_t c2 = gSimUart2.C2;
+        if (((s1 & UART_S1_RDRF_MASK) && (c2 & UART_C2_RIE_MASK)) ||
+            ((s1 & UART_S1_TDRE_MASK) && (c2 & UART_C2_TIE_MASK)) ||
+            ((s1 & UART_S1_TC_MASK) && (c2 & UART_C2_TCIE_MASK))) {
+            pending |= 1u << UART2_FLEXIO_IRQn;
+        }
+        pending &= nvicEnabled;
+        if (pending == 0u) {
+            return;
+        }
+
+        uint32_t irq = SIM_IRQ_COUNT;
+        for (uint32_t i = 0; i < SIM_IRQ_COUNT; ++i) {
+            if ((pending & (1u << i)) && (irq == SIM_IRQ_COUNT || nvicPriority[i] < nvicPriority[irq])) {
+                irq = i;
+            }
+        }
+        nvicPending &= ~(1u << irq);
+        irqCount[irq]++;
+        if (kVectors[irq] != NULL) {
+            kVectors[irq]();
+        } else {
+            warn_once(WARN_NO_HANDLER, "interrupt enabled without a handler");
+        }
+        if (irq == (uint32_t)UART2_FLEXIO_IRQn) {
+            gSimUart2.S1 &= ~UART_S1_RDRF_MASK;
+        }
+    }
+}
+
+static void sim_irq_task(void *pvParameters) {
+    (void)pvParameters;
+    TickType_t last = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelay(1);
+        TickType_t now = xTaskGetTickCount();
+        uint32_t elapsedUs = (uint32_t)(now - last) * (1000000u / configTICK_RATE_HZ);
+        last = now;
+
+        SimEsp32_Step(Sim_NowMs());
+        uart_advance(elapsedUs);
+        adc_service();
+        uart_service_tx();
+        dma_step(elapsedUs);
+        tpm_step();
+        gpio_step();
+        dispatch_irqs();
+        Sim_Step(Sim_NowMs());
+    }
+}
+
+void SimHw_Init(void) {
+    // The firmware stores RAM addresses in 32-bit DMA registers; a non-PIE
+    // link (Makefile) keeps every static object below 4 GiB.
+    if ((uintptr_t)&gSimDac0 > UINT32_MAX) {
+        fprintf(stderr, "sim: static data above 4 GiB, link with -no-pie\n");
+        exit(2);
+    }
+
+    memset(&gSimAdc0, 0, sizeof(gSimAdc0));
+    memset(&gSimUart2, 0, sizeof(gSimUart2));
+    memset(gSimTpm, 0, sizeof(gSimTpm));
+    memset(gSimGpio, 0, sizeof(gSimGpio));
+    memset(gSimPort, 0, sizeof(gSimPort));
+    memset(&gSimSim, 0, sizeof(gSimSim));
+    memset(&gSimDac0, 0, sizeof(gSimDac0));
+    memset(&gSimDma0, 0, sizeof(gSimDma0));
+    memset(&gSimDmamux0, 0, sizeof(gSimDmamux0));
+
+    // Reset values the firmware relies on.
+    gSimAdc0.SC1[0] = ADC_SC1_ADCH(31);
+    adcLastSc1 = gSimAdc0.SC1[0];
+    gSimUart2.BDL = 0x04u;
+    gSimUart2.S1 = UART_S1_TDRE_MASK | UART_S1_TC_MASK;
+    gSimUart2.D = SIM_UART_D_IDLE;
+    for (uint32_t t = 0; t < 3u; ++t) {
+        gSimTpm[t].MOD = 0xFFFFu;
+    }
+    for (uint32_t ch = 0; ch < SIM_ADC_CHANNELS; ++ch) {
+        (void)SimWave_Parse(&adcWave[ch], "0", 0u);
+    }
+}
+
+void SimHw_Start(void) {
+    static StaticTask_t tcb;
+    static StackType_t stack[configMINIMAL_STACK_SIZE];
+    TaskHandle_t h = xTaskCreateStatic(sim_irq_task, "SimIRQ", configMINIMAL_STACK_SIZE, NULL,
+                                       SIM_IRQ_TASK_PRIORITY, stack, &tcb);
+    configASSERT(h != NULL);
+}
+
+void SimHw_Finish(void) {
+    Sim_Log("adc %lu conversions, uart rx %lu tx %lu bytes (%lu dropped), dma %lu transfers",
+            (unsigned long)adcConversions, (unsigned long)rxBytes, (unsigned long)txBytes,
+            (unsigned long)rxDropped, (unsigned long)dmaTransfers);
+    for (uint32_t i = 0; i < SIM_IRQ_COUNT; ++i) {
+        if (irqCount[i] != 0u) {
+            Sim_Log("irq %u: %lu", (unsigned)i, (unsigned long)irqCount[i]);
+        }
+    }
+    if (wavFile != NULL) {
+        wav_header();
+        fclose(wavFile);
+        wavFile = NULL;
+        Sim_Log("wav %lu samples at %lu Hz", (unsigned long)wavSamples, (unsigned long)wavRate);
+    }
+}
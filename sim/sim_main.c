@@ -0,0 +1,265 @@
+/*
+ * @file    sim_main.c
+ * @brief   Host entry point of the simulation: options, console, checks
+ *
+ * The firmware's main() is compiled as App_Main (-Dmain=App_Main) and runs
+ * unchanged once the models are set up; it never returns. The run ends at
+ * --duration or at the script's "end" step, with exit status 1 if any
+ * expectation was missed.
+ */
+
+#define _GNU_SOURCE
+
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "sim.h"
+
+#define SIM_MAX_CHECKS      128u
+#define SIM_CHECK_TEXT      128u
+#define SIM_CONSOLE_LINE    512u
+
+#define SIM_DEFAULT_WATER   "2000"   // ADC0_SE14, PTC0
+#define SIM_DEFAULT_LIGHT   "3"      // ADC0_SE0, PTE20 (low = bright)
+
+typedef struct {
+    uint32_t byMs;
+    bool met;
+    bool reported;
+    char text[SIM_CHECK_TEXT];
+} SimCheck_t;
+
+static SimCheck_t checks[SIM_MAX_CHECKS];
+static uint32_t checkCount;
+static uint32_t failures;
+static uint32_t endMs;              // 0 = run until interrupted
+
+static char consoleLine[SIM_CONSOLE_LINE];
+static size_t consoleLen;
+
+extern int App_Main(void);
+
+/* -------------------- OUTPUT -------------------- */
+// The POSIX port switches tasks from a signal handler; stdio must not be
+// entered by two tasks at once, so output runs with the tick masked.
+static bool in_scheduler(void) {
+    return xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+}
+
+#define SIM_OUTPUT_BEGIN()  do { if (in_scheduler()) taskENTER_CRITICAL(); } while (0)
+#define SIM_OUTPUT_END()    do { if (in_scheduler()) taskEXIT_CRITICAL(); } while (0)
+
+uint32_t Sim_NowMs(void) {
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+void Sim_Log(const char *fmt, ...) {
+    char text[SIM_CONSOLE_LINE];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(text, sizeof(text), fmt, ap);
+    va_end(ap);
+
+    SIM_OUTPUT_BEGIN();
+    printf("SIM %7lu %s\n", (unsigned long)Sim_NowMs(), text);
+    fflush(stdout);
+    SIM_OUTPUT_END();
+    SimCheck_Line(text);
+}
+
+// PRINTF of the firmware. Lines are passed through as written ("\r\n"
+// stripped) and matched against the expectations once complete.
+int Sim_ConsolePrintf(const char *fmt, ...) {
+    char text[SIM_CONSOLE_LINE];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(text, sizeof(text), fmt, ap);
+    va_end(ap);
+
+    SIM_OUTPUT_BEGIN();
+    for (const char *p = text; *p != '\0'; ++p) {
+        if (*p == '\r') {
+            continue;
+        }
+        if (*p != '\n' && consoleLen + 1u < sizeof(consoleLine)) {
+            consoleLine[consoleLen++] = *p;
+            continue;
+        }
+        if (*p == '\n') {
+            consoleLine[consoleLen] = '\0';
+            puts(consoleLine);
+            SimCheck_Line(consoleLine);
+            consoleLen = 0u;
+        }
+    }
+    fflush(stdout);
+    SIM_OUTPUT_END();
+    return n;
+}
+
+void Sim_AssertFailed(const char *file, int line) {
+    printf("SIM %7lu ASSERT %s:%d\n", (unsigned long)Sim_NowMs(), file, line);
+    fflush(stdout);
+    SimHw_Finish();
+    exit(2);
+}
+
+/* -------------------- EXPECTATIONS -------------------- */
+void SimCheck_Add(uint32_t byMs, const char *text) {
+    if (checkCount >= SIM_MAX_CHECKS) {
+        fprintf(stderr, "sim: more than %u expectations, \"%s\" ignored\n",
+                (unsigned)SIM_MAX_CHECKS, text);
+        return;
+    }
+    SimCheck_t *c = &checks[checkCount++];
+    c->byMs = byMs;
+    snprintf(c->text, sizeof(c->text), "%s", text);
+}
+
+// An expectation is met by any output line containing its text up to its
+// deadline, including lines printed before the previous script step.
+void SimCheck_Line(const char *line) {
+    uint32_t now = Sim_NowMs();
+    for (uint32_t i = 0; i < checkCount; ++i) {
+        SimCheck_t *c = &checks[i];
+        if (!c->met && !c->reported && now <= c->byMs && strstr(line, c->text) != NULL) {
+            c->met = true;
+        }
+    }
+}
+
+void Sim_SetEndMs(uint32_t ms) {
+    endMs = ms;
+}
+
+static void finish(void) {
+    uint32_t met = 0;
+    for (uint32_t i = 0; i < checkCount; ++i) {
+        if (checks[i].met) {
+            met++;
+        } else if (!checks[i].reported) {
+            printf("SIM %7lu FAIL by %lu: \"%s\"\n", (unsigned long)Sim_NowMs(),
+                   (unsigned long)checks[i].byMs, checks[i].text);
+            failures++;
+        }
+    }
+    SimHw_Finish();
+    printf("SIM %7lu end: %lu/%lu expectations met\n", (unsigned long)Sim_NowMs(),
+           (unsigned long)met, (unsigned long)checkCount);
+    fflush(stdout);
+    exit((failures != 0u) ? 1 : 0);
+}
+
+void Sim_Step(uint32_t nowMs) {
+    SIM_OUTPUT_BEGIN();
+    for (uint32_t i = 0; i < checkCount; ++i) {
+        SimCheck_t *c = &checks[i];
+        if (!c->met && !c->reported && nowMs > c->byMs) {
+            c->reported = true;
+            failures++;
+            printf("SIM %7lu FAIL by %lu: \"%s\"\n", (unsigned long)nowMs,
+                   (unsigned long)c->byMs, c->text);
+        }
+    }
+    fflush(stdout);
+    if (endMs != 0u && nowMs >= endMs) {
+        finish();
+    }
+    SIM_OUTPUT_END();
+}
+
+/* -------------------- OPTIONS -------------------- */
+static void usage(const char *argv0) {
+    printf("usage: %s [options]\n"
+           "  --adc CH=WAVE     ADC0 channel input (repeatable; default 14=%s, 0=%s)\n"
+           "  --temp WAVE       DHT temperature the ESP32 stand-in reports (default 25)\n"
+           "  --hum WAVE        DHT humidity (default 60)\n"
+           "  --esp32 SCRIPT    timed sends, waveform changes and expectations\n"
+           "  --pty             UART2 on a pseudo-terminal instead of the stand-in\n"
+           "  --duration MS     stop after MS simulated milliseconds\n"
+           "  --wav PATH        write DAC0 output (audio clips) to a WAV file\n"
+           "WAVE: N | const:N | sine:MID:AMP:PERIOD_MS | square:LO:HI:PERIOD_MS |\n"
+           "      ramp:FROM:TO:DURATION_MS | file:PATH\n",
+           argv0, SIM_DEFAULT_WATER, SIM_DEFAULT_LIGHT);
+}
+
+static bool set_adc(const char *arg) {
+    char *end = NULL;
+    unsigned long ch = strtoul(arg, &end, 10);
+    SimWave_t wave;
+    if (end == arg || *end != '=' || ch > 31u || !SimWave_Parse(&wave, end + 1, 0u)) {
+        fprintf(stderr, "sim: --adc expects CH=WAVE, got \"%s\"\n", arg);
+        return false;
+    }
+    SimHw_SetAdcWave((uint8_t)ch, &wave);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    static const struct option kOptions[] = {
+        { "adc",      required_argument, NULL, 'a' },
+        { "temp",     required_argument, NULL, 't' },
+        { "hum",      required_argument, NULL, 'u' },
+        { "esp32",    required_argument, NULL, 'e' },
+        { "pty",      no_argument,       NULL, 'p' },
+        { "duration", required_argument, NULL, 'd' },
+        { "wav",      required_argument, NULL, 'w' },
+        { "help",     no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+    SimWave_t wave;
+
+    SimHw_Init();
+    SimEsp32_Init();
+    (void)set_adc("14=" SIM_DEFAULT_WATER);
+    (void)set_adc("0=" SIM_DEFAULT_LIGHT);
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", kOptions, NULL)) != -1) {
+        bool ok = true;
+        switch (opt) {
+        case 'a':
+            ok = set_adc(optarg);
+            break;
+        case 't':
+            ok = SimWave_Parse(&wave, optarg, 0u);
+            if (ok) SimEsp32_SetDht(&wave, NULL);
+            break;
+        case 'u':
+            ok = SimWave_Parse(&wave, optarg, 0u);
+            if (ok) SimEsp32_SetDht(NULL, &wave);
+            break;
+        case 'e':
+            ok = SimEsp32_LoadScript(optarg);
+            break;
+        case 'p':
+            ok = SimEsp32_OpenPty();
+            break;
+        case 'd':
+            Sim_SetEndMs((uint32_t)strtoul(optarg, NULL, 10));
+            break;
+        case 'w':
+            ok = SimHw_OpenWav(optarg);
+            if (!ok) fprintf(stderr, "sim: cannot create %s\n", optarg);
+            break;
+        case 'h':
+            usage(argv[0]);
+            return 0;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+        if (!ok) {
+            return 2;
+        }
+    }
+
+    SimHw_Start();
+    return App_Main();
+}
@@ -0,0 +1,141 @@
+/*
+ * @file    sim_platform.c
+ * @brief   Board, clock, run-time clock and low-power stand-ins for the simulation
+ *
+ * Replaces the parts of the firmware that only make sense on silicon:
+ * board/ and drivers/ init (the models start out configured), the PIT based
+ * run-time clock (host monotonic clock instead), SysTick (time since the
+ * last kernel tick) and tickless idle (holds are accepted and ignored).
+ */
+
+#include <time.h>
+
+#include "board.h"
+#include "clock_config.h"
+#include "fsl_clock.h"
+#include "peripherals.h"
+#include "pin_mux.h"
+
+#include "FreeRTOS.h"
+
+#include "low_power.h"
+#include "runtime_clock.h"
+
+#include "sim.h"
+
+#define SIM_CORE_CLOCK_HZ   48000000u
+#define SIM_BUS_CLOCK_HZ    24000000u
+
+uint32_t SystemCoreClock = SIM_CORE_CLOCK_HZ;
+
+/* -------------------- BOARD / CLOCKS -------------------- */
+void BOARD_InitBootPins(void) {}
+void BOARD_InitBootClocks(void) {}
+void BOARD_InitBootPeripherals(void) {}
+void BOARD_InitDebugConsole(void) {}
+
+uint32_t CLOCK_GetFreq(clock_name_t name) {
+    switch (name) {
+    case kCLOCK_BusClk:
+        return SIM_BUS_CLOCK_HZ;
+    case kCLOCK_McgPeriphClk:
+    case kCLOCK_CoreSysClk:
+    default:
+        return SIM_CORE_CLOCK_HZ;
+    }
+}
+
+uint32_t CLOCK_GetCoreSysClkFreq(void) {
+    return SIM_CORE_CLOCK_HZ;
+}
+
+uint32_t CLOCK_GetBusClkFreq(void) {
+    return SIM_BUS_CLOCK_HZ;
+}
+
+void SDK_DelayAtLeastUs(uint32_t delayTime_us, uint32_t coreClock_Hz) {
+    (void)coreClock_Hz;
+    struct timespec ts = { (time_t)(delayTime_us / 1000000u), (long)(delayTime_us % 1000000u) * 1000L };
+    while (nanosleep(&ts, &ts) != 0) {
+    }
+}
+
+/* -------------------- RUN-TIME CLOCK -------------------- */
+static uint64_t startNs;
+
+static uint64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+void RuntimeClock_Init(void) {
+    startNs = host_ns();
+}
+
+uint32_t RuntimeClock_Ticks(void) {
+    return (uint32_t)((host_ns() - startNs) / (1000000000u / RUNTIME_CLOCK_HZ));
+}
+
+// Bus-clock cycles, as PIT0/PIT1 count them on target.
+uint64_t RuntimeClock_Cycles(void) {
+    return (host_ns() - startNs) * (SIM_BUS_CLOCK_HZ / 1000000u) / 1000u;
+}
+
+uint32_t RuntimeClock_Cycles32(void) {
+    return (uint32_t)RuntimeClock_Cycles();
+}
+
+uint32_t RuntimeClock_CyclesPerTick(void) {
+    return SIM_BUS_CLOCK_HZ / RUNTIME_CLOCK_HZ;
+}
+
+uint32_t RuntimeClock_CyclesToUs(uint64_t cycles) {
+    return (uint32_t)(cycles / (SIM_BUS_CLOCK_HZ / 1000000u));
+}
+
+/* -------------------- SYSTICK -------------------- */
+static SysTick_Type sysTick;
+SCB_Type gSimScb;
+static volatile uint64_t lastTickNs;
+
+// Runs in the port's tick signal handler; clock_gettime is signal-safe.
+void vApplicationTickHook(void) {
+    lastTickNs = host_ns();
+}
+
+SysTick_Type *Sim_SysTickAccess(void) {
+    uint32_t perTick = SIM_CORE_CLOCK_HZ / configTICK_RATE_HZ;
+    uint64_t intoTickNs = (lastTickNs != 0u) ? host_ns() - lastTickNs : 0u;
+    uint64_t cycles = intoTickNs * (SIM_CORE_CLOCK_HZ / 1000000u) / 1000u;
+    sysTick.LOAD = perTick - 1u;
+    sysTick.VAL = (cycles < perTick) ? (uint32_t)(perTick - 1u - cycles) : 0u;
+    return &sysTick;
+}
+
+/* -------------------- LOW POWER -------------------- */
+static uint32_t holds;
+
+void LowPower_Init(void) {
+    holds = 0u;
+}
+
+void LowPower_Hold(uint32_t sources) {
+    holds |= sources;
+}
+
+void LowPower_Release(uint32_t sources) {
+    holds &= ~sources;
+}
+
+void LowPower_Defer(uint32_t ms) {
+    (void)ms;
+}
+
+void LowPower_GetStats(LowPowerStats_t *out) {
+    *out = (LowPowerStats_t){ 0 };
+}
+
+void LowPower_SuppressTicksAndSleep(TickType_t expectedIdleTicks) {
+    (void)expectedIdleTicks;
+}
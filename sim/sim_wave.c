@@ -0,0 +1,133 @@
+/*
+ * @file    sim_wave.c
+ * @brief   Stimulus waveforms for the simulated sensors
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+
+#define SIM_WAVE_MAX_POINTS 4096u
+
+static bool parse_floats(const char *text, float *out, int count) {
+    char *end = NULL;
+    for (int i = 0; i < count; ++i) {
+        out[i] = strtof(text, &end);
+        if (end == text) {
+            return false;
+        }
+        text = end;
+        if (i + 1 < count) {
+            if (*text != ':') {
+                return false;
+            }
+            text++;
+        }
+    }
+    return *text == '\0';
+}
+
+static bool load_table(SimWave_t *wave, const char *path) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        fprintf(stderr, "sim: cannot open %s\n", path);
+        return false;
+    }
+    uint32_t *ms = malloc(SIM_WAVE_MAX_POINTS * sizeof(*ms));
+    float *value = malloc(SIM_WAVE_MAX_POINTS * sizeof(*value));
+    uint16_t n = 0;
+    char line[128];
+    while (ms != NULL && value != NULL && fgets(line, sizeof(line), f) != NULL) {
+        unsigned long t;
+        float v;
+        if (line[0] == '#' || sscanf(line, "%lu%*[ ,\t]%f", &t, &v) != 2) {
+            continue;               // comments, blank lines, CSV header
+        }
+        if (n == SIM_WAVE_MAX_POINTS) {
+            fprintf(stderr, "sim: %s: only the first %u points are used\n", path,
+                    (unsigned)SIM_WAVE_MAX_POINTS);
+            break;
+        }
+        ms[n] = (uint32_t)t;
+        value[n] = v;
+        n++;
+    }
+    fclose(f);
+    if (n == 0u) {
+        fprintf(stderr, "sim: %s: no \"<ms> <value>\" lines\n", path);
+        free(ms);
+        free(value);
+        return false;
+    }
+    wave->kind = SIM_WAVE_TABLE;
+    wave->points = n;
+    wave->pointMs = ms;
+    wave->pointValue = value;
+    return true;
+}
+
+bool SimWave_Parse(SimWave_t *wave, const char *spec, uint32_t startMs) {
+    float v[3] = { 0.0f, 0.0f, 0.0f };
+    SimWave_t w;
+    memset(&w, 0, sizeof(w));
+    w.startMs = startMs;
+
+    if (strncmp(spec, "file:", 5) == 0) {
+        if (!load_table(&w, spec + 5)) {
+            return false;
+        }
+    } else if (strncmp(spec, "const:", 6) == 0 && parse_floats(spec + 6, v, 1)) {
+        w.kind = SIM_WAVE_CONST;
+    } else if (strncmp(spec, "sine:", 5) == 0 && parse_floats(spec + 5, v, 3) && v[2] > 0.0f) {
+        w.kind = SIM_WAVE_SINE;
+    } else if (strncmp(spec, "square:", 7) == 0 && parse_floats(spec + 7, v, 3) && v[2] > 0.0f) {
+        w.kind = SIM_WAVE_SQUARE;
+    } else if (strncmp(spec, "ramp:", 5) == 0 && parse_floats(spec + 5, v, 3)) {
+        w.kind = SIM_WAVE_RAMP;
+    } else if (parse_floats(spec, v, 1)) {
+        w.kind = SIM_WAVE_CONST;
+    } else {
+        fprintf(stderr, "sim: bad waveform \"%s\"\n", spec);
+        return false;
+    }
+    w.a = v[0];
+    w.b = v[1];
+    w.c = v[2];
+    *wave = w;
+    return true;
+}
+
+float SimWave_Value(const SimWave_t *wave, uint32_t nowMs) {
+    uint32_t t = (nowMs >= wave->startMs) ? nowMs - wave->startMs : 0u;
+    switch (wave->kind) {
+    case SIM_WAVE_SINE:
+        return wave->a + wave->b * sinf(6.2831853f * (float)t / wave->c);
+    case SIM_WAVE_SQUARE:
+        return (fmodf((float)t, wave->c) < wave->c * 0.5f) ? wave->a : wave->b;
+    case SIM_WAVE_RAMP:
+        if (wave->c <= 0.0f || (float)t >= wave->c) {
+            return wave->b;
+        }
+        return wave->a + (wave->b - wave->a) * (float)t / wave->c;
+    case SIM_WAVE_TABLE: {
+        uint16_t n = wave->points;
+        if (t <= wave->pointMs[0]) {
+            return wave->pointValue[0];
+        }
+        for (uint16_t i = 1; i < n; ++i) {
+            if (t < wave->pointMs[i]) {
+                float span = (float)(wave->pointMs[i] - wave->pointMs[i - 1u]);
+                float f = (float)(t - wave->pointMs[i - 1u]) / span;
+                return wave->pointValue[i - 1u] + f * (wave->pointValue[i] - wave->pointValue[i - 1u]);
+            }
+        }
+        return wave->pointValue[n - 1u];
+    }
+    case SIM_WAVE_CONST:
+    default:
+        return wave->a;
+    }
+}
@@ -18,40 +18,70 @@
 #include "task.h"
 #include "queue.h"
 #include "semphr.h"
-
+#include "stream_buffer.h"
+
+#include "actuator_mailbox.h"
+#include "cmd_token.h"
+#include "deadline_monitor.h"
+#include "dht11.h"
+#include "event_hub.h"
+#include "fast_fmt.h"
+#include "log_console.h"
+#include "log.h"
+#include "low_power.h"
+#include "mutex_profile.h"
+#include "plant_rules.h"
+#include "rtos_objects.h"
+#include "rtos_stats.h"
 #include "sensor.h"
+#include "trace_recorder.h"
 #include "uart_bridge.h"
 
 #define UART_TX_PTE22   22
 #define UART_RX_PTE23   23
 #define UART2_INT_PRIO  128
-#define MAX_MSG_LEN     128
-#define RX_QUEUE_LEN    5
+#define MAX_MSG_LEN     UART_BRIDGE_MAX_MSG_LEN
+#define UART_IDLE_GRACE_MS  100u  // stay out of VLPS this long after a line
+#define UART_REPLY_WAIT_MS  100u  // ... and after GET_DHT, for the reply
+#define UART_TELEMETRY_PERIOD_MS  2000u
+#define UART_TX_WAIT_MS     500u  // longest the stats task waits for TX room (~480 bytes at 9600)
+#define UART_HUB_TX_WAIT_MS  50u   // ... and a hub handler, so it never stalls the other events
 
 typedef struct {
     char message[MAX_MSG_LEN];
 } UartMessage_t;
+_Static_assert(sizeof(UartMessage_t) == UART_BRIDGE_MAX_MSG_LEN, "rtos_objects.h UartRx item size");
 
 static QueueHandle_t rxQueue;
-static SemaphoreHandle_t txMutex;
+static SemaphoreHandle_t txMutex;        // one line at a time into txStream
+static StreamBufferHandle_t txStream;    // drained by the UART2 TX interrupt
+static uint32_t txDropped;               // lines that found no room in time (STAT uart)
+
+// Work the hub hands to the stats task: a bit per request, with the
+// StatsRequest semaphore as its doorbell (as event_hub.c does).
+enum { STATS_REQ_REPORT = 1u << 0, STATS_REQ_TRACE = 1u << 1 };
+static uint32_t statsRequests;
 
 static SensorData_t *gSensorData;
 static SemaphoreHandle_t gSensorDataMutex;
 
 static void initUART2(uint32_t baud_rate);
 static void handle_incoming_payload(const char *payload);
-static BaseType_t uart_send_locked(const char *msg);
-static void uart_request_task(void *pv);
-static void uart_receive_task(void *pv);
+static BaseType_t uart_send(const char *msg, TickType_t wait);
+static void send_stats_report(void);
 
 void UART_Bridge_Init(uint32_t baud_rate)
 {
-    rxQueue = xQueueCreate(RX_QUEUE_LEN, sizeof(UartMessage_t));
+    // Statically allocated in rtos_objects.c
+    rxQueue = RTOS_QUEUE(UartRx);
     configASSERT(rxQueue != NULL);
 
-    txMutex = xSemaphoreCreateMutex();
+    txMutex = RTOS_SEMAPHORE(UartTx);
     configASSERT(txMutex != NULL);
 
+    txStream = RTOS_STREAM_BUFFER(UartTx);
+    configASSERT(txStream != NULL);
+
     gSensorData = NULL;
     gSensorDataMutex = NULL;
 
@@ -64,16 +94,9 @@ void UART_Bridge_SetSensorDataHandle(SensorData_t *sharedData, SemaphoreHandle_t
     gSensorDataMutex = dataMutex;
 }
 
-void UART_Bridge_StartTasks(UBaseType_t recvPriority, UBaseType_t pollPriority)
-{
-    configASSERT(rxQueue != NULL);
-    xTaskCreate(uart_receive_task, "UART-RX", configMINIMAL_STACK_SIZE + 256, NULL, recvPriority, NULL);
-    xTaskCreate(uart_request_task, "UART-TX", configMINIMAL_STACK_SIZE + 128, NULL, pollPriority, NULL);
-}
-
 BaseType_t UART_Bridge_Send(const char *msg)
 {
-    return uart_send_locked(msg);
+    return uart_send(msg, pdMS_TO_TICKS(UART_HUB_TX_WAIT_MS));
 }
 
 BaseType_t UART_Bridge_SendSensorTelemetry(const SensorData_t *data)
@@ -83,14 +106,13 @@ BaseType_t UART_Bridge_SendSensorTelemetry(const SensorData_t *data)
     }
 
     char buffer[MAX_MSG_LEN];
-    int written = snprintf(buffer, sizeof(buffer),
-                           "{\"photo\":%lu,\"water\":%lu}\n",
-                           (unsigned long)data->light_intensity,
-                           (unsigned long)data->water_level);
-    if (written <= 0 || written >= (int)sizeof(buffer)) {
+    int written = FAST_FMT(buffer, sizeof(buffer),
+                           FMT_LIT("{\"photo\":") FMT_U(data->light_intensity)
+                           FMT_LIT(",\"water\":") FMT_U(data->water_level) FMT_LIT("}\n"));
+    if (written <= 0) {
         return pdFAIL;
     }
-    return uart_send_locked(buffer);
+    return uart_send(buffer, pdMS_TO_TICKS(UART_HUB_TX_WAIT_MS));
 }
 
 static void initUART2(uint32_t baud_rate)
@@ -112,33 +134,76 @@ static void initUART2(uint32_t baud_rate)
 
     UART2->C1 = 0x00; // 8N1
     UART2->C2 = UART_C2_RIE_MASK | UART_C2_RE_MASK | UART_C2_TE_MASK; // Enable RX interrupt + RX/TX
+    UART2->BDH |= UART_BDH_RXEDGIE_MASK; // start-bit edge wakes the core from VLPS
 
     NVIC_SetPriority(UART2_FLEXIO_IRQn, UART2_INT_PRIO);
     NVIC_ClearPendingIRQ(UART2_FLEXIO_IRQn);
     NVIC_EnableIRQ(UART2_FLEXIO_IRQn);
 }
 
-static BaseType_t uart_send_locked(const char *msg)
+// Copies the whole line into txStream and arms the TX interrupt. The mutex
+// is held only for the copy, once the line is known to fit; while the
+// stream is too full the sender polls outside it, so a stats line waiting
+// for the UART never blocks the hub. Lines still without room after
+// `wait` ticks are dropped and counted.
+static BaseType_t uart_send(const char *msg, TickType_t wait)
 {
     if (msg == NULL || txMutex == NULL) {
         return pdFAIL;
     }
 
-    if (xSemaphoreTake(txMutex, pdMS_TO_TICKS(50)) != pdTRUE) {
-        return pdFAIL;
-    }
+    size_t len = strlen(msg);
+    BaseType_t result = pdFAIL;
+    TimeOut_t timeout;
+    vTaskSetTimeOutState(&timeout);
+    for (;;) {
+        if (MutexProfile_Take(txMutex, wait) != pdTRUE) {
+            break;
+        }
+        // Only the TX interrupt reads the stream, so room can only grow.
+        if (xStreamBufferSpacesAvailable(txStream) >= len) {
+            (void)xStreamBufferSend(txStream, msg, len, 0);
+
+            // UART2 stops in VLPS: hold it until the last byte has left (TC).
+            taskENTER_CRITICAL();
+            LowPower_Hold(LOW_POWER_HOLD_UART_TX);
+            UART2->C2 = (uint8_t)((UART2->C2 & ~UART_C2_TCIE_MASK) | UART_C2_TIE_MASK);
+            taskEXIT_CRITICAL();
+            result = pdPASS;
+        }
+        MutexProfile_Give(txMutex);
 
-    const char *p = msg;
-    while (*p != '\0') {
-        while (!(UART2->S1 & UART_S1_TDRE_MASK)) {
+        if (result == pdPASS || xTaskCheckForTimeOut(&timeout, &wait) != pdFALSE) {
+            break;
         }
-        UART2->D = *(p++);
+        vTaskDelay(1);
     }
-    while (!(UART2->S1 & UART_S1_TC_MASK)) {
+
+    if (result != pdPASS) {
+        taskENTER_CRITICAL();
+        txDropped++;
+        taskEXIT_CRITICAL();
     }
+    return result;
+}
 
-    xSemaphoreGive(txMutex);
-    return pdPASS;
+// Feeds TDRE from txStream; once it is empty, waits for TC to drop the hold.
+static void uart_tx_isr(BaseType_t *hpw)
+{
+    uint8_t c2 = UART2->C2;
+    uint8_t s1 = UART2->S1;
+
+    if ((c2 & UART_C2_TIE_MASK) && (s1 & UART_S1_TDRE_MASK)) {
+        uint8_t byte;
+        if (xStreamBufferReceiveFromISR(txStream, &byte, 1u, hpw) == 1u) {
+            UART2->D = byte;
+        } else {
+            UART2->C2 = (uint8_t)((c2 & ~UART_C2_TIE_MASK) | UART_C2_TCIE_MASK);
+        }
+    } else if ((c2 & UART_C2_TCIE_MASK) && (s1 & UART_S1_TC_MASK)) {
+        UART2->C2 = (uint8_t)(c2 & ~UART_C2_TCIE_MASK);
+        LowPower_Release(LOW_POWER_HOLD_UART_TX);
+    }
 }
 
 void UART2_FLEXIO_IRQHandler(void)
@@ -146,6 +211,15 @@ void UART2_FLEXIO_IRQHandler(void)
     static size_t recv_index = 0;
     static char recv_buffer[MAX_MSG_LEN];
     BaseType_t hpw = pdFALSE;
+    TraceRecorder_IsrEnter();
+
+    // First edge of a line: stay out of VLPS (UART2 stops there) until the
+    // hub has handled the whole line. Edge interrupts are off meanwhile.
+    if (UART2->S2 & UART_S2_RXEDGIF_MASK) {
+        UART2->S2 |= UART_S2_RXEDGIF_MASK;
+        UART2->BDH &= ~UART_BDH_RXEDGIE_MASK;
+        LowPower_Hold(LOW_POWER_HOLD_UART);
+    }
 
     if (UART2->S1 & UART_S1_RDRF_MASK) {
         char rxByte = UART2->D;
@@ -164,27 +238,209 @@ void UART2_FLEXIO_IRQHandler(void)
         }
     }
 
+    uart_tx_isr(&hpw);
+
+    TraceRecorder_IsrExit();
     portYIELD_FROM_ISR(hpw);
 }
 
-static void uart_receive_task(void *pv)
+// Hub handlers (event_hub.h)
+
+void UART_Bridge_OnFrame(HubEvent_t event, const void *payload)
+{
+    (void)event;
+    const char *line = (const char *)payload;
+    LOG_DEBUG(BRIDGE, "From ESP32: %s\r\n", line);
+    handle_incoming_payload(line);
+    if (uxQueueMessagesWaiting(rxQueue) == 0u) {
+        LowPower_Defer(UART_IDLE_GRACE_MS);
+        LowPower_Release(LOW_POWER_HOLD_UART);
+        UART2->BDH |= UART_BDH_RXEDGIE_MASK;
+    }
+}
+
+void UART_Bridge_OnPollTimer(HubEvent_t event, const void *payload)
 {
-    (void)pv;
-    UartMessage_t message;
-    while (1) {
-        if (xQueueReceive(rxQueue, &message, portMAX_DELAY) == pdTRUE) {
-            PRINTF("From ESP32: %s\r\n", message.message);
-            handle_incoming_payload(message.message);
+    (void)event;
+    (void)payload;
+    static TickType_t lastStatsTick;
+    char frame[MAX_MSG_LEN];
+
+    // Only fall back to the ESP32's DHT while the local one has nothing
+    // fresh. The reply follows within a few ms; keep UART2 clocked for it.
+    // Its first edge takes the UART hold; if the ESP32 never answers, the
+    // window simply lapses.
+    if (!Dht11_IsFresh()) {
+        LowPower_Defer(UART_REPLY_WAIT_MS);
+        (void)UART_Bridge_Send("GET_DHT\n");
+    }
+
+    // Compact CPU-usage frame for the ESP32 display
+    TickType_t now = xTaskGetTickCount();
+    if ((now - lastStatsTick) >= pdMS_TO_TICKS(RTOS_STATS_PERIOD_MS)) {
+        RtosStats_Sample();
+        if (RtosStats_FormatFrame(frame, sizeof(frame)) == pdPASS) {
+            (void)UART_Bridge_Send(frame);
         }
+        lastStatsTick = now;
     }
 }
 
-static void uart_request_task(void *pv)
+// Posted by the sensor task after every sample; telemetry goes out at
+// UART_TELEMETRY_PERIOD_MS so the sensor task never waits on UART2.
+void UART_Bridge_OnSensorUpdate(HubEvent_t event, const void *payload)
 {
-    (void)pv;
-    while (1) {
-        uart_send_locked("GET_DHT\n");
-        vTaskDelay(pdMS_TO_TICKS(2000));
+    (void)event;
+    (void)payload;
+    static TickType_t lastTelemetryTick;
+
+    TickType_t now = xTaskGetTickCount();
+    if (gSensorData == NULL || gSensorDataMutex == NULL ||
+        (now - lastTelemetryTick) < pdMS_TO_TICKS(UART_TELEMETRY_PERIOD_MS)) {
+        return;
+    }
+    SensorData_t snapshot;
+    if (MutexProfile_Take(gSensorDataMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+        snapshot = *gSensorData;
+        MutexProfile_Give(gSensorDataMutex);
+        UART_Bridge_SendSensorTelemetry(&snapshot);
+        lastTelemetryTick = now;
+    }
+}
+
+// The stats task may wait longer than the hub for TX room.
+static void stats_send(const char *line)
+{
+    (void)uart_send(line, pdMS_TO_TICKS(UART_TX_WAIT_MS));
+}
+
+// STATS: per-task CPU share of the last window, the periodic tasks'
+// deadline counters, hub event latency, mutex contention, actuator mailbox
+// traffic and console log drops, to the ESP32 and the console.
+static void send_stats_report(void)
+{
+    RtosTaskStat_t stats[RTOS_STATS_MAX_TASKS];
+    DeadlineStat_t deadlines[DEADLINE_COUNT];
+    HubStat_t events[HUB_EVENT_COUNT];
+    MutexStat_t mutexes[MUTEX_PROFILE_MAX];
+    LogRingStat_t logs[4];
+    char line[MAX_MSG_LEN];
+    uint8_t n = RtosStats_Get(stats, RTOS_STATS_MAX_TASKS);
+
+    for (uint8_t i = 0; i < n; ++i) {
+        (void)FAST_FMT(line, sizeof(line), FMT_LIT("STAT ") FMT_S(stats[i].name) FMT_C(' ')
+                       FMT_U(stats[i].cpuPercent) FMT_LIT("% ") FMT_U(stats[i].runTimeTicks) FMT_C('\n'));
+        stats_send(line);
+        PRINTF("%s", line);
+    }
+
+    n = DeadlineMonitor_Get(deadlines, DEADLINE_COUNT);
+    for (uint8_t i = 0; i < n; ++i) {
+        const DeadlineStat_t *d = &deadlines[i];
+        snprintf(line, sizeof(line), "STAT dl %s %lu/%lums n=%lu miss=%lu over=%lu wcet=%luus jit=%luus\n",
+                 d->name, (unsigned long)d->periodMs, (unsigned long)d->deadlineMs,
+                 (unsigned long)d->cycles, (unsigned long)d->misses, (unsigned long)d->overruns,
+                 (unsigned long)d->wcetUs, (unsigned long)d->jitterUs);
+        stats_send(line);
+        PRINTF("%s", line);
+    }
+
+    n = EventHub_GetStats(events, HUB_EVENT_COUNT);
+    for (uint8_t i = 0; i < n; ++i) {
+        const HubStat_t *e = &events[i];
+        snprintf(line, sizeof(line), "STAT hub %s n=%lu co=%lu late=%lu lat=%luus h=%luus\n",
+                 e->name, (unsigned long)e->calls, (unsigned long)e->coalesced,
+                 (unsigned long)e->late, (unsigned long)e->latencyMaxUs,
+                 (unsigned long)e->handlerMaxUs);
+        stats_send(line);
+        PRINTF("%s", line);
+    }
+
+    n = MutexProfile_Get(mutexes, MUTEX_PROFILE_MAX);
+    for (uint8_t i = 0; i < n; ++i) {
+        const MutexStat_t *m = &mutexes[i];
+        snprintf(line, sizeof(line), "STAT mx %s n=%lu c=%lu to=%lu pi=%lu wait=%lu hold=%lu/%luus p=%u/%u\n",
+                 m->name, (unsigned long)m->takes, (unsigned long)m->contended,
+                 (unsigned long)m->timeouts, (unsigned long)m->inherits, (unsigned long)m->waitMaxUs,
+                 (unsigned long)(m->takes ? m->holdTotalUs / m->takes : 0u), (unsigned long)m->holdMaxUs,
+                 (unsigned)m->ownerPrioMax, (unsigned)m->waiterPrioMax);
+        stats_send(line);
+        PRINTF("%s", line);
+    }
+
+    ActuatorMailboxStats_t mbox;
+    ActuatorMailbox_GetStats(&mbox);
+    snprintf(line, sizeof(line), "STAT mbox post=%lu co=%lu alert=%lu drop=%lu out=%lu\n",
+             (unsigned long)mbox.posted, (unsigned long)mbox.coalesced, (unsigned long)mbox.alerts,
+             (unsigned long)mbox.dropped, (unsigned long)mbox.delivered);
+    stats_send(line);
+    PRINTF("%s", line);
+
+    n = LogConsole_GetStats(logs, 4u);
+    for (uint8_t i = 0; i < n; ++i) {
+        const LogRingStat_t *l = &logs[i];
+        snprintf(line, sizeof(line), "STAT log %s n=%lu drop=%lu/%luB hw=%lu/%lu\n",
+                 l->name, (unsigned long)l->messages, (unsigned long)l->droppedMessages,
+                 (unsigned long)l->droppedBytes, (unsigned long)l->highWater, (unsigned long)l->size);
+        stats_send(line);
+        PRINTF("%s", line);
+    }
+
+#if (DHT11_LOCAL_ENABLE > 0)
+    Dht11Stats_t dht;
+    Dht11_GetStats(&dht);
+    snprintf(line, sizeof(line), "STAT dht n=%lu ok=%lu bad=%lu none=%lu age=%lums\n",
+             (unsigned long)dht.reads, (unsigned long)dht.ok, (unsigned long)dht.bad,
+             (unsigned long)dht.noResponse, (unsigned long)dht.ageMs);
+    stats_send(line);
+    PRINTF("%s", line);
+#endif
+
+    snprintf(line, sizeof(line), "STAT uart txdrop=%lu\n", (unsigned long)txDropped);
+    stats_send(line);
+    PRINTF("%s", line);
+
+    LowPowerStats_t lp;
+    LowPower_GetStats(&lp);
+    snprintf(line, sizeof(line), "STAT sleep %lu ms (%lu deep) %lu wakes\n",
+             (unsigned long)lp.sleptMs, (unsigned long)lp.deepMs, (unsigned long)lp.sleeps);
+    stats_send(line);
+    PRINTF("%s", line);
+    stats_send("STAT END\n");
+}
+
+static void stats_request(uint32_t bit)
+{
+    taskENTER_CRITICAL();
+    statsRequests |= bit;
+    taskEXIT_CRITICAL();
+    (void)xSemaphoreGive(RTOS_SEMAPHORE(StatsRequest));
+}
+
+void UART_Bridge_StatsTask(void *pvParameters)
+{
+    (void)pvParameters;
+    SemaphoreHandle_t request = RTOS_SEMAPHORE(StatsRequest);
+
+    for (;;) {
+        if (xSemaphoreTake(request, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        taskENTER_CRITICAL();
+        uint32_t req = statsRequests;
+        statsRequests = 0u;
+        taskEXIT_CRITICAL();
+
+        if (req & STATS_REQ_REPORT) {
+            send_stats_report();
+        }
+#if (configUSE_TRACE_RECORDER == 1)
+        if (req & STATS_REQ_TRACE) {
+            char ack[32];
+            snprintf(ack, sizeof(ack), "OK TRACE %lu\n", (unsigned long)TraceRecorder_Dump());
+            stats_send(ack);
+        }
+#endif
     }
 }
 
@@ -194,6 +450,41 @@ static void handle_incoming_payload(const char *payload)
         return;
     }
 
+    char verb[8];
+    const char *args = payload;
+    bool hasVerb = CmdToken_Next(&args, verb, sizeof(verb));
+
+    // The report takes seconds at 9600 baud: hand it to the stats task.
+    if (hasVerb && CmdToken_Equals(verb, "STATS")) {
+        stats_request(STATS_REQ_REPORT);
+        return;
+    }
+
+    // Kernel trace ring to the debug console (trace_recorder.h); the dump
+    // is ~5 KB of PRINTF, so it runs on the stats task too.
+    if (hasVerb && CmdToken_Equals(verb, "TRACE")) {
+#if (configUSE_TRACE_RECORDER == 1)
+        stats_request(STATS_REQ_TRACE);
+#else
+        (void)UART_Bridge_Send("ERR TRACE off\n");
+#endif
+        return;
+    }
+
+    // Rule/threshold updates forwarded by the ESP32
+    char reply[32];
+    if (PlantRules_HandleCommand(payload, reply, sizeof(reply))) {
+        (void)UART_Bridge_Send(reply);
+        return;
+    }
+
+    // Runtime log levels (log.h)
+    char logReply[64];
+    if (Log_HandleCommand(payload, logReply, sizeof(logReply))) {
+        (void)UART_Bridge_Send(logReply);
+        return;
+    }
+
     const char *tempPos = strstr(payload, "\"temperature\"");
     if (tempPos == NULL) {
         tempPos = strstr(payload, "\"temp\"");
@@ -216,5 +507,5 @@ static void handle_incoming_payload(const char *payload)
     float humidity = strtof(humPos + 1, NULL);
 
     Sensor_UpdateRemoteReadings(temperature, humidity);
-    PRINTF("ESP32 DHT -> temp: %.2f C, humidity: %.2f %%\r\n", temperature, humidity);
+    LOG_INFO(BRIDGE, "ESP32 DHT -> temp: %.2f C, humidity: %.2f %%\r\n", temperature, humidity);
 }
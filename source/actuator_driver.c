@@ -1,11 +1,4 @@
-#include "board.h"
-#include "pin_mux.h"
-#include "fsl_common.h"
-#include "fsl_clock.h"
-#include "fsl_device_registers.h"
-
-#include "music_library.h"
-#include "actuator_driver.h"
+#include <stdbool.h>
 
 #include "board.h"
 #include "pin_mux.h"
@@ -13,74 +6,105 @@
 #include "fsl_clock.h"
 #include "fsl_device_registers.h"
 
+#include "FreeRTOS.h"
+#include "task.h"
+
 #include "actuator_driver.h"
+#include "actuator_mailbox.h"
+#include "audio_player.h"
 #include "music_library.h"
+#include "pwm_service.h"
 
-#define LED_PIN_PTC   1u    // external LED on PTC1
-#define BUZ_PIN_PTC   2u    // buzzer S on PTC2
+#define LED_PIN_PTC   1u    // external LED on PTC1 (ALT4 = TPM0_CH0)
+#define BUZ_PIN_PTC   2u    // buzzer S on PTC2 (ALT4 = TPM0_CH1)
+
+// LED and buzzer share TPM0, so the LED accepts whatever tone the buzzer
+// is playing; the duty cycle (brightness) is kept across retunes.
+#define LED_PWM_HZ        1000u
+#define LED_PWM_MIN_HZ    100u
+#define LED_PWM_MAX_HZ    20000u
+#define BUZ_PWM_MIN_HZ    100u
+#define BUZ_PWM_MAX_HZ    10000u
+
+// 1: alerts play the sampled clip on DAC0 (PTE30) via DMA instead of
+// the buzzer beep pattern.
+#ifndef ALERT_USE_DAC_AUDIO
+#define ALERT_USE_DAC_AUDIO 1
+#endif
+
+static PwmHandle_t ledPwm = PWM_INVALID_HANDLE;
+static PwmHandle_t buzzerPwm = PWM_INVALID_HANDLE;
 
 static inline void delay_us(uint32_t us) {
     SDK_DelayAtLeastUs(us, SystemCoreClock);
 }
 
-/* -------------------- BUZZER (GPIO) -------------------- */
+// Sleeps inside tasks; spins before the scheduler is up.
+static void wait_ms(uint32_t ms) {
+    if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+        vTaskDelay(pdMS_TO_TICKS(ms));
+    } else {
+        delay_us(ms * 1000u);
+    }
+}
+
+/* -------------------- BUZZER (TPM0 CH1 on PTC2) -------------------- */
 static void buzzer_init(void) {
-    SIM->SCGC5 |= SIM_SCGC5_PORTC_MASK;
-    PORTC->PCR[BUZ_PIN_PTC] =
-        (PORTC->PCR[BUZ_PIN_PTC] & ~PORT_PCR_MUX_MASK) | PORT_PCR_MUX(1); // GPIO
-    GPIOC->PDDR |= (1u << BUZ_PIN_PTC);
-    GPIOC->PCOR   = (1u << BUZ_PIN_PTC);
+    const PwmChannelConfig_t cfg = {
+        .port = PORTC, .pin = BUZ_PIN_PTC, .mux = 4u,
+        .timer = PWM_TPM0, .channel = 1u,
+        .minHz = BUZ_PWM_MIN_HZ, .maxHz = BUZ_PWM_MAX_HZ,
+        .activeLow = false,
+    };
+    buzzerPwm = PWM_Open(&cfg, LED_PWM_HZ);
+    configASSERT(buzzerPwm != PWM_INVALID_HANDLE);
 }
 
-static void buzzer_play_gpio(uint32_t freq_hz, uint32_t ms) {
+static void buzzer_off(void) {
+    PWM_SetDuty(buzzerPwm, 0u);
+}
+
+// The timer generates the square wave; the task just sleeps for the note.
+static void buzzer_play_tone(uint32_t freq_hz, uint32_t ms) {
     if (!ms) return;
 
-    if (!freq_hz) {          // rest
-        delay_us(ms * 1000u);
-        GPIOC->PCOR = (1u << BUZ_PIN_PTC);
+    if (!freq_hz || PWM_SetFrequency(buzzerPwm, freq_hz) != pdPASS) {   // rest
+        buzzer_off();
+        wait_ms(ms);
         return;
     }
+    PWM_SetDuty(buzzerPwm, PWM_DUTY_HALF);
+    wait_ms(ms);
+    buzzer_off();
+}
 
-    uint32_t half_us = 500000u / freq_hz;
-    if (!half_us) half_us = 1;
-    uint32_t toggles = (ms * 1000u) / half_us;
-    if (toggles & 1u) toggles--;
-
-    for (uint32_t i = 0; i < toggles; ++i) {
-        GPIOC->PTOR = (1u << BUZ_PIN_PTC);
-        delay_us(half_us);
-    }
-    GPIOC->PCOR = (1u << BUZ_PIN_PTC);
+// Tune notes yield to a pending alert, so an alert waits at most for the
+// note in progress instead of the rest of the tune.
+static void buzzer_play_note(uint32_t freq_hz, uint32_t ms) {
+    if (ActuatorMailbox_AlertPending()) return;
+    buzzer_play_tone(freq_hz, ms);
 }
 
-/* -------------------- LED (TPM0 on PTC1) -------------------- */
+/* -------------------- LED (TPM0 CH0 on PTC1) -------------------- */
 static void led_init(void) {
-    SIM->SCGC5 |= SIM_SCGC5_PORTC_MASK;
-    PORTC->PCR[1] = (PORTC->PCR[1] & ~PORT_PCR_MUX_MASK) | PORT_PCR_MUX(4); // ALT4 = TPM0_CH0
-    SIM->SCGC6 |= SIM_SCGC6_TPM0_MASK;
-    SIM->SOPT2 = (SIM->SOPT2 & ~SIM_SOPT2_TPMSRC_MASK) | SIM_SOPT2_TPMSRC(1);
-
-    TPM0->SC  = 0;
-    TPM0->CNT = 0;
-    TPM0->SC |= TPM_SC_PS(7);        // prescaler 128
-    TPM0->SC |= TPM_SC_CPWMS_MASK;   // center-aligned
-    TPM0->MOD = 125;                 // ~250 Hz
-
-    // high-true PWM  ➜  use ELSA if your LED is active-low
-    TPM0->CONTROLS[0].CnSC = TPM_CnSC_MSB_MASK | TPM_CnSC_ELSB_MASK;
-    TPM0->CONTROLS[0].CnV  = 0;
-
-    TPM0->SC = (TPM0->SC & ~TPM_SC_CMOD_MASK) | TPM_SC_CMOD(1); // start
+    // high-true PWM  ➜  set activeLow if your LED is wired active-low
+    const PwmChannelConfig_t cfg = {
+        .port = PORTC, .pin = LED_PIN_PTC, .mux = 4u,
+        .timer = PWM_TPM0, .channel = 0u,
+        .minHz = LED_PWM_MIN_HZ, .maxHz = LED_PWM_MAX_HZ,
+        .activeLow = false,
+    };
+    ledPwm = PWM_Open(&cfg, LED_PWM_HZ);
+    configASSERT(ledPwm != PWM_INVALID_HANDLE);
 }
 
 void Set_LED_Intensity(uint8_t intensity) {
-    // map 0..255 -> 0..MOD
-    uint32_t mod = TPM0->MOD;
-    uint32_t cv  = (uint32_t)((intensity / 255.0f) * (float)mod);
-    TPM0->CONTROLS[0].CnV = cv;
+    // map 0..255 -> 0..0xFFFF (x257 maps 255 exactly to full on)
+    PWM_SetDuty(ledPwm, (uint16_t)(intensity * 257u));
 }
 
 /* -------------------- PUBLIC API -------------------- */
+// Requires PWM_Init().
 void Actuators_Init(void) {
     led_init();
     buzzer_init();
@@ -88,25 +112,73 @@ void Actuators_Init(void) {
 }
 
 
-void Play_Music(MusicType_t music_type) {
+static void play_music_with(MusicType_t music_type, void (*play_tone)(uint32_t, uint32_t)) {
     switch (music_type) {
     case MUSIC_OFF:
-    	GPIOC->PCOR = (1u << BUZ_PIN_PTC);
+        buzzer_off();
+#if ALERT_USE_DAC_AUDIO
+        Audio_Stop();
+#endif
         break;
     case MUSIC_HAPPY:
-        Music_Play(HAPPY_TUNES, buzzer_play_gpio);
+        Music_Play(HAPPY_TUNES, play_tone);
         break;
     case MUSIC_SAD:
-        Music_Play(SAD_TUNES, buzzer_play_gpio);
+        Music_Play(SAD_TUNES, play_tone);
         break;
     case MUSIC_ALERT:
+#if ALERT_USE_DAC_AUDIO
+        Audio_Play(AUDIO_CLIP_ALERT);
+#else
         // simple built-in alert
         for (int i = 0; i < 3; i++) {
-            buzzer_play_gpio(2000, 150);
-            delay_us(80000u);
+            buzzer_play_tone(2000, 150);
+            wait_ms(80u);
         }
+#endif
         break;
     default:
         break;
     }
 }
+
+void Play_Music(MusicType_t music_type) {
+    play_music_with(music_type, buzzer_play_tone);
+}
+
+/* -------------------- OUTPUT TASK -------------------- */
+// Sole owner of the LED and buzzer: everything else posts to the mailbox.
+void Actuator_Output_Task(void *pvParameters) {
+    (void)pvParameters;
+    ActuatorCommand_t cmd;
+    bool isAlert = false;
+
+    for (;;) {
+        if (ActuatorMailbox_Receive(&cmd, &isAlert, portMAX_DELAY) != pdPASS) {
+            continue;
+        }
+
+        // Alerts run to completion; normal buzzer work gives way to them.
+        void (*tone)(uint32_t, uint32_t) = isAlert ? buzzer_play_tone : buzzer_play_note;
+
+        switch (cmd.type) {
+        case ACTUATOR_LED:
+            Set_LED_Intensity((uint8_t)(cmd.value1 > 255u ? 255u : cmd.value1));
+            break;
+        case ACTUATOR_BUZZER_TONE:
+            tone(cmd.value1, cmd.value2);
+            break;
+        case ACTUATOR_BUZZER_MUSIC_HAPPY:
+            play_music_with(MUSIC_HAPPY, tone);
+            break;
+        case ACTUATOR_BUZZER_MUSIC_STRESSED:
+            play_music_with(MUSIC_SAD, tone);
+            break;
+        case ACTUATOR_BUZZER_ALERT:
+            play_music_with(MUSIC_ALERT, tone);
+            break;
+        default:
+            break;
+        }
+    }
+}
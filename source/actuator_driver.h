@@ -10,8 +10,23 @@ typedef enum {
     MUSIC_ALERT
 } MusicType_t;
 
+typedef enum {
+    ACTUATOR_LED = 0,                // value1: intensity 0..255
+    ACTUATOR_BUZZER_TONE,            // value1: frequency (Hz), value2: duration (ms)
+    ACTUATOR_BUZZER_MUSIC_HAPPY,
+    ACTUATOR_BUZZER_MUSIC_STRESSED,
+    ACTUATOR_BUZZER_ALERT
+} ActuatorType_t;
+
+typedef struct {
+    ActuatorType_t type;
+    uint32_t value1;
+    uint32_t value2;
+} ActuatorCommand_t;
+
 void Actuators_Init(void);
 void Set_LED_Intensity(uint8_t intensity_0_255);
 void Play_Music(MusicType_t music_type);
+void Actuator_Output_Task(void *pvParameters);
 
 #endif
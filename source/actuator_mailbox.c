@@ -0,0 +1,174 @@
+/*
+ * @file    actuator_mailbox.c
+ * @brief   Coalescing actuator command mailbox with a strict-priority alert lane
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "actuator_driver.h"
+#include "actuator_mailbox.h"
+#include "rtos_objects.h"
+
+typedef enum {
+    SLOT_LED = 0,
+    SLOT_BUZZER,
+    SLOT_COUNT
+} ActuatorSlot_t;
+
+static ActuatorCommand_t slots[SLOT_COUNT];
+static uint8_t slotPending;                 // bit n set => slots[n] holds an undelivered command
+
+static ActuatorCommand_t alertFifo[ACTUATOR_ALERT_DEPTH];
+static uint8_t alertHead;
+static uint8_t alertCount;
+
+static ActuatorMailboxStats_t stats;
+static SemaphoreHandle_t xPendingSemaphore; // given on every post, taken by the reader
+
+static int slot_for(ActuatorType_t type)
+{
+    switch (type) {
+    case ACTUATOR_LED:
+        return SLOT_LED;
+    case ACTUATOR_BUZZER_TONE:
+    case ACTUATOR_BUZZER_MUSIC_HAPPY:
+    case ACTUATOR_BUZZER_MUSIC_STRESSED:
+    case ACTUATOR_BUZZER_ALERT:
+        return SLOT_BUZZER;
+    default:
+        return -1;
+    }
+}
+
+void ActuatorMailbox_Init(void)
+{
+    memset(slots, 0, sizeof(slots));
+    memset(&stats, 0, sizeof(stats));
+    slotPending = 0u;
+    alertHead = 0u;
+    alertCount = 0u;
+
+    xPendingSemaphore = RTOS_SEMAPHORE(ActuatorPending);
+    configASSERT(xPendingSemaphore != NULL);
+}
+
+BaseType_t ActuatorMailbox_Post(const ActuatorCommand_t *cmd)
+{
+    if (cmd == NULL) {
+        return pdFAIL;
+    }
+    int slot = slot_for(cmd->type);
+    if (slot < 0) {
+        return pdFAIL;
+    }
+
+    taskENTER_CRITICAL();
+    if (slotPending & (1u << slot)) {
+        stats.coalesced++;
+    }
+    slots[slot] = *cmd;
+    slotPending |= (uint8_t)(1u << slot);
+    stats.posted++;
+    taskEXIT_CRITICAL();
+
+    xSemaphoreGive(xPendingSemaphore);
+    return pdPASS;
+}
+
+BaseType_t ActuatorMailbox_PostAlert(const ActuatorCommand_t *cmd)
+{
+    if (cmd == NULL || slot_for(cmd->type) < 0) {
+        return pdFAIL;
+    }
+
+    BaseType_t result = pdPASS;
+    taskENTER_CRITICAL();
+    if (alertCount >= ACTUATOR_ALERT_DEPTH) {
+        stats.dropped++;
+        result = pdFAIL;
+    } else {
+        alertFifo[(alertHead + alertCount) % ACTUATOR_ALERT_DEPTH] = *cmd;
+        alertCount++;
+        stats.posted++;
+        stats.alerts++;
+    }
+    taskEXIT_CRITICAL();
+
+    if (result == pdPASS) {
+        xSemaphoreGive(xPendingSemaphore);
+    }
+    return result;
+}
+
+// Pops the highest-priority pending command: alerts first, then the LED
+// (cheap register write) before the buzzer (may block for a whole tune).
+static bool pop_next(ActuatorCommand_t *cmd, bool *isAlert)
+{
+    bool found = false;
+
+    taskENTER_CRITICAL();
+    if (alertCount > 0u) {
+        *cmd = alertFifo[alertHead];
+        alertHead = (uint8_t)((alertHead + 1u) % ACTUATOR_ALERT_DEPTH);
+        alertCount--;
+        *isAlert = true;
+        found = true;
+    } else {
+        for (int slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (slotPending & (1u << slot)) {
+                *cmd = slots[slot];
+                slotPending &= (uint8_t)~(1u << slot);
+                *isAlert = false;
+                found = true;
+                break;
+            }
+        }
+    }
+    if (found) {
+        stats.delivered++;
+    }
+    taskEXIT_CRITICAL();
+
+    return found;
+}
+
+BaseType_t ActuatorMailbox_Receive(ActuatorCommand_t *cmd, bool *isAlert, TickType_t timeout)
+{
+    bool alert = false;
+    if (cmd == NULL || xPendingSemaphore == NULL) {
+        return pdFAIL;
+    }
+
+    // The semaphore only says "something was posted"; several posts can
+    // collapse into one give, so always drain before blocking again.
+    while (!pop_next(cmd, &alert)) {
+        if (xSemaphoreTake(xPendingSemaphore, timeout) != pdTRUE) {
+            return pdFAIL;
+        }
+    }
+
+    if (isAlert) {
+        *isAlert = alert;
+    }
+    return pdPASS;
+}
+
+bool ActuatorMailbox_AlertPending(void)
+{
+    return alertCount > 0u;
+}
+
+void ActuatorMailbox_GetStats(ActuatorMailboxStats_t *out)
+{
+    if (out == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL();
+    *out = stats;
+    taskEXIT_CRITICAL();
+}
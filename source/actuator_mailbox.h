@@ -0,0 +1,35 @@
+#ifndef ACTUATOR_MAILBOX_H_
+#define ACTUATOR_MAILBOX_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+#include "actuator_driver.h"
+
+// Depth of the alert lane. Alerts are never coalesced, so a burst larger
+// than this is dropped (and counted) instead of blocking the sender.
+#define ACTUATOR_ALERT_DEPTH   4u
+
+typedef struct {
+    uint32_t posted;     // commands accepted (normal + alert)
+    uint32_t coalesced;  // pending normal commands overwritten by a newer one
+    uint32_t dropped;    // alerts rejected because the alert lane was full
+    uint32_t delivered;  // commands handed to the output task
+    uint32_t alerts;     // alerts accepted
+} ActuatorMailboxStats_t;
+
+void ActuatorMailbox_Init(void);
+
+// Normal commands: one slot per actuator, latest value wins.
+BaseType_t ActuatorMailbox_Post(const ActuatorCommand_t *cmd);
+// Alert commands: FIFO, always delivered before any normal command.
+BaseType_t ActuatorMailbox_PostAlert(const ActuatorCommand_t *cmd);
+
+// Blocks until a command is available. isAlert (optional) reports the lane.
+BaseType_t ActuatorMailbox_Receive(ActuatorCommand_t *cmd, bool *isAlert, TickType_t timeout);
+bool ActuatorMailbox_AlertPending(void);
+void ActuatorMailbox_GetStats(ActuatorMailboxStats_t *stats);
+
+#endif /* ACTUATOR_MAILBOX_H_ */
@@ -0,0 +1,369 @@
+/*
+ * @file    audio_clips.c
+ * @brief   IMA ADPCM alert clips (8 kHz mono)
+ *
+ * Generated by tools/wav2adpcm.py - regenerate instead of editing.
+ */
+
+#include "audio_clips.h"
+
+static const uint8_t kClip_alert[3200] = {
+    0x70, 0xF7, 0xFF, 0x47, 0xE9, 0x2A, 0x16, 0xDA, 0x39, 0x05, 0xCB, 0x48, 0x83, 0xAD, 0x41, 0xA2,
+    0x9D, 0x52, 0xA0, 0x8C, 0x43, 0xD0, 0x0A, 0x24, 0xC9, 0x2A, 0x15, 0xCA, 0x39, 0x04, 0xCB, 0x30,
+    0x94, 0xAC, 0x51, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x1C, 0x33, 0xE9, 0x19, 0x14, 0xCA,
+    0x28, 0x03, 0xCB, 0x40, 0x82, 0x9D, 0x40, 0x91, 0x8C, 0x41, 0xA0, 0x8B, 0x43, 0xB8, 0x1C, 0x24,
+    0xD9, 0x19, 0x14, 0xCA, 0x28, 0x03, 0xCB, 0x40, 0x82, 0x9D, 0x31, 0xA2, 0x9D, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x84, 0xBA, 0x40, 0x82, 0x9D, 0x40, 0x91, 0x8C, 0x41, 0xA0, 0x8B, 0x43, 0xB8, 0x1C, 0x24,
+    0xD9, 0x19, 0x14, 0xBA, 0x39, 0x04, 0xCB, 0x30, 0x83, 0x9E, 0x40, 0x91, 0x8C, 0x41, 0xA0, 0x8B,
+    0x43, 0xB8, 0x1C, 0x24, 0xBA, 0x3B, 0x15, 0xCA, 0x39, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x84, 0xBA, 0x58,
+    0x92, 0xAB, 0x51, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x33, 0xC8, 0x0A, 0x34, 0xCA, 0x2A, 0x05, 0xC9,
+    0x28, 0x03, 0xCB, 0x30, 0x94, 0xAC, 0x32, 0xB3, 0x9D, 0x42, 0xB1, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xBB, 0x58, 0x92, 0xAB, 0x51, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x33, 0xC8, 0x0A, 0x15, 0xB9, 0x2A, 0x15, 0xCA, 0x28, 0x84, 0xBA, 0x40, 0x82, 0xAC, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x33, 0xC8, 0x0A, 0x24, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xBB, 0x40,
+    0x82, 0x9D, 0x31, 0x91, 0x9D, 0x42, 0xA0, 0x8B, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x03, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x8C, 0x31, 0xB1, 0x8C, 0x43, 0xB8, 0x1B, 0x24,
+    0xC9, 0x19, 0x13, 0xCA, 0x38, 0x83, 0xBB, 0x40, 0x82, 0x9C, 0x30, 0x91, 0x8B, 0x22, 0x98, 0x09,
+    0x20, 0x06, 0xFC, 0x8B, 0x74, 0x02, 0xEA, 0x8B, 0x52, 0x14, 0xD9, 0xAB, 0x41, 0x34, 0xC8, 0xAC,
+    0x28, 0x35, 0xA1, 0xBD, 0x1A, 0x45, 0x81, 0xDB, 0x0A, 0x43, 0x03, 0xDB, 0x9B, 0x52, 0x23, 0xD9,
+    0xAB, 0x40, 0x24, 0xB0, 0xAD, 0x29, 0x35, 0x90, 0xBC, 0x1A, 0x44, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x40, 0x23, 0xB9, 0xAD, 0x20, 0x25, 0xA0, 0xAC, 0x19,
+    0x44, 0x91, 0xCB, 0x1A, 0x52, 0x82, 0xCA, 0x8A, 0x51, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x02,
+    0xD9, 0x9A, 0x41, 0x13, 0xB9, 0xAC, 0x30, 0x25, 0xB0, 0xBC, 0x28, 0x44, 0x91, 0xBC, 0x09, 0x53,
+    0x82, 0xDA, 0x0A, 0x41, 0x12, 0xBA, 0x9D, 0x31, 0x24, 0xC8, 0xAB, 0x20, 0x35, 0xB0, 0xBC, 0x18,
+    0x35, 0x91, 0xBC, 0x0A, 0x34, 0x03, 0xEB, 0x8A, 0x41, 0x13, 0xCA, 0xAB, 0x41, 0x24, 0xB8, 0xBC,
+    0x20, 0x25, 0xA1, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x32, 0x15, 0xB9,
+    0xAC, 0x40, 0x23, 0xB0, 0xBD, 0x38, 0x34, 0x90, 0xAD, 0x1A, 0x34, 0x82, 0xBC, 0x8B, 0x63, 0x02,
+    0xC9, 0x9B, 0x32, 0x15, 0xC8, 0x9B, 0x30, 0x24, 0xA0, 0xBD, 0x28, 0x34, 0x91, 0xBD, 0x09, 0x34,
+    0x02, 0xBC, 0x8B, 0x53, 0x03, 0xD9, 0x9B, 0x41, 0x23, 0xC8, 0x9C, 0x28, 0x34, 0xA0, 0xAD, 0x29,
+    0x43, 0x91, 0xCB, 0x0A, 0x53, 0x02, 0xCB, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x31, 0x15, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x18, 0x43, 0x92, 0xDB, 0x0A, 0x43, 0x02, 0xDA, 0x8A, 0x41, 0x12, 0xC8,
+    0xAB, 0x31, 0x25, 0xB8, 0xAC, 0x28, 0x34, 0xA1, 0xBC, 0x1A, 0x44, 0x81, 0xCA, 0x8A, 0x43, 0x02,
+    0xD9, 0x9A, 0x41, 0x22, 0xB9, 0xAC, 0x30, 0x24, 0xA0, 0xBC, 0x28, 0x34, 0x90, 0xBC, 0x09, 0x34,
+    0x82, 0xCB, 0x8A, 0x42, 0x03, 0xBA, 0x9C, 0x31, 0x14, 0xA9, 0x9B, 0x20, 0x13, 0xA0, 0x9A, 0x10,
+    0x00, 0x08, 0x88, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xF7, 0xFF, 0x47, 0xE9, 0x2A, 0x16, 0xDA, 0x39, 0x05, 0xCB, 0x48, 0x83, 0xAD, 0x41, 0xA2,
+    0x9D, 0x52, 0xA0, 0x8C, 0x43, 0xD0, 0x0A, 0x24, 0xC9, 0x2A, 0x15, 0xCA, 0x39, 0x04, 0xCB, 0x30,
+    0x94, 0xAC, 0x51, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x1C, 0x33, 0xE9, 0x19, 0x14, 0xCA,
+    0x28, 0x03, 0xCB, 0x40, 0x82, 0x9D, 0x40, 0x91, 0x8C, 0x41, 0xA0, 0x8B, 0x43, 0xB8, 0x1C, 0x24,
+    0xD9, 0x19, 0x14, 0xCA, 0x28, 0x03, 0xCB, 0x40, 0x82, 0x9D, 0x31, 0xA2, 0x9D, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xCB, 0x30,
+    0x83, 0xAD, 0x41, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x84, 0xBA, 0x40, 0x82, 0x9D, 0x40, 0x91, 0x8C, 0x41, 0xA0, 0x8B, 0x43, 0xB8, 0x1C, 0x24,
+    0xD9, 0x19, 0x14, 0xBA, 0x39, 0x04, 0xCB, 0x30, 0x83, 0x9E, 0x40, 0x91, 0x8C, 0x41, 0xA0, 0x8B,
+    0x43, 0xB8, 0x1C, 0x24, 0xBA, 0x3B, 0x15, 0xCA, 0x39, 0x04, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x84, 0xBA, 0x58,
+    0x92, 0xAB, 0x51, 0x91, 0x9C, 0x42, 0xA0, 0x8C, 0x33, 0xC8, 0x0A, 0x34, 0xCA, 0x2A, 0x05, 0xC9,
+    0x28, 0x03, 0xCB, 0x30, 0x94, 0xAC, 0x32, 0xB3, 0x9D, 0x42, 0xB1, 0x8C, 0x43, 0xB8, 0x0B, 0x25,
+    0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xBB, 0x58, 0x92, 0xAB, 0x51, 0x91, 0x9C, 0x42, 0xA0, 0x8C,
+    0x33, 0xC8, 0x0A, 0x15, 0xB9, 0x2A, 0x15, 0xCA, 0x28, 0x84, 0xBA, 0x40, 0x82, 0xAC, 0x41, 0x91,
+    0x9C, 0x42, 0xA0, 0x8C, 0x33, 0xC8, 0x0A, 0x24, 0xC9, 0x19, 0x14, 0xCA, 0x28, 0x04, 0xBB, 0x40,
+    0x82, 0x9D, 0x31, 0x91, 0x9D, 0x42, 0xA0, 0x8B, 0x43, 0xB8, 0x0B, 0x25, 0xC9, 0x19, 0x14, 0xCA,
+    0x28, 0x03, 0xCB, 0x30, 0x83, 0xAD, 0x41, 0x91, 0x8C, 0x31, 0xB1, 0x8C, 0x43, 0xB8, 0x1B, 0x24,
+    0xC9, 0x19, 0x13, 0xCA, 0x38, 0x83, 0xBB, 0x40, 0x82, 0x9C, 0x30, 0x91, 0x8B, 0x22, 0x98, 0x09,
+    0x20, 0x06, 0xFC, 0x8B, 0x74, 0x02, 0xEA, 0x8B, 0x52, 0x14, 0xD9, 0xAB, 0x41, 0x34, 0xC8, 0xAC,
+    0x28, 0x35, 0xA1, 0xBD, 0x1A, 0x45, 0x81, 0xDB, 0x0A, 0x43, 0x03, 0xDB, 0x9B, 0x52, 0x23, 0xD9,
+    0xAB, 0x40, 0x24, 0xB0, 0xAD, 0x29, 0x35, 0x90, 0xBC, 0x1A, 0x44, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x40, 0x23, 0xB9, 0xAD, 0x20, 0x25, 0xA0, 0xAC, 0x19,
+    0x44, 0x91, 0xCB, 0x1A, 0x52, 0x82, 0xCA, 0x8A, 0x51, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x12,
+    0xDA, 0x9A, 0x41, 0x13, 0xC8, 0x9C, 0x20, 0x24, 0xA0, 0xAD, 0x18, 0x34, 0x91, 0xCC, 0x09, 0x43,
+    0x82, 0xDA, 0x8A, 0x42, 0x03, 0xD9, 0x9A, 0x31, 0x24, 0xC8, 0x9C, 0x38, 0x43, 0xA0, 0xBC, 0x19,
+    0x35, 0x91, 0xDB, 0x0A, 0x53, 0x82, 0xCA, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x40, 0x14, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x51, 0x12, 0xB9,
+    0xAC, 0x40, 0x14, 0xB0, 0xCB, 0x28, 0x34, 0x91, 0xBD, 0x19, 0x53, 0x82, 0xDB, 0x0A, 0x42, 0x02,
+    0xD9, 0x9A, 0x41, 0x13, 0xB9, 0xAC, 0x30, 0x25, 0xB0, 0xBC, 0x28, 0x44, 0x91, 0xBC, 0x09, 0x53,
+    0x82, 0xDA, 0x0A, 0x41, 0x12, 0xBA, 0x9D, 0x31, 0x24, 0xC8, 0xAB, 0x20, 0x35, 0xB0, 0xBC, 0x18,
+    0x35, 0x91, 0xBC, 0x0A, 0x34, 0x03, 0xEB, 0x8A, 0x41, 0x13, 0xCA, 0xAB, 0x41, 0x24, 0xB8, 0xBC,
+    0x20, 0x25, 0xA1, 0xBC, 0x19, 0x44, 0x81, 0xCB, 0x0A, 0x52, 0x02, 0xCA, 0x8B, 0x32, 0x15, 0xB9,
+    0xAC, 0x40, 0x23, 0xB0, 0xBD, 0x38, 0x34, 0x90, 0xAD, 0x1A, 0x34, 0x82, 0xBC, 0x8B, 0x63, 0x02,
+    0xC9, 0x9B, 0x32, 0x15, 0xC8, 0x9B, 0x30, 0x24, 0xA0, 0xBD, 0x28, 0x34, 0x91, 0xBD, 0x09, 0x34,
+    0x02, 0xBC, 0x8B, 0x53, 0x03, 0xD9, 0x9B, 0x41, 0x23, 0xC8, 0x9C, 0x28, 0x34, 0xA0, 0xAD, 0x29,
+    0x43, 0x91, 0xCB, 0x0A, 0x53, 0x02, 0xCB, 0x9A, 0x52, 0x12, 0xC9, 0x9B, 0x31, 0x15, 0xA8, 0xAC,
+    0x28, 0x25, 0x90, 0xBC, 0x18, 0x43, 0x92, 0xDB, 0x0A, 0x43, 0x02, 0xDA, 0x8A, 0x41, 0x12, 0xC8,
+    0xAB, 0x31, 0x25, 0xB8, 0xAC, 0x28, 0x34, 0xA1, 0xBC, 0x1A, 0x44, 0x81, 0xCA, 0x8A, 0x43, 0x02,
+    0xD9, 0x9A, 0x41, 0x22, 0xB9, 0xAC, 0x30, 0x24, 0xA0, 0xBC, 0x28, 0x34, 0x90, 0xBC, 0x09, 0x34,
+    0x82, 0xCB, 0x8A, 0x42, 0x03, 0xBA, 0x9C, 0x31, 0x14, 0xA9, 0x9B, 0x20, 0x13, 0xA0, 0x9A, 0x10,
+    0x00, 0x08, 0x88, 0x00, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t kClip_chime[2400] = {
+    0x70, 0x77, 0xFF, 0x2B, 0x23, 0x54, 0x05, 0xEE, 0x8A, 0x45, 0x92, 0xBC, 0x08, 0x12, 0x21, 0x04,
+    0xFC, 0x0B, 0x73, 0x81, 0xBA, 0x09, 0x21, 0x20, 0x23, 0xFC, 0x8C, 0x62, 0x82, 0xBA, 0x0A, 0x21,
+    0x20, 0x13, 0xFA, 0x8E, 0x41, 0x03, 0xBB, 0x0B, 0x21, 0x21, 0x32, 0xFA, 0x9E, 0x41, 0x03, 0xC9,
+    0x8A, 0x11, 0x11, 0x21, 0xD8, 0xAD, 0x41, 0x14, 0xB9, 0x8B, 0x20, 0x11, 0x22, 0xD0, 0xAE, 0x30,
+    0x16, 0xB8, 0x8B, 0x10, 0x11, 0x31, 0xB0, 0xCF, 0x38, 0x25, 0xB8, 0x9B, 0x10, 0x11, 0x22, 0xB1,
+    0xCF, 0x39, 0x35, 0xB8, 0xAB, 0x10, 0x12, 0x31, 0xA1, 0xDF, 0x29, 0x34, 0xB1, 0xAC, 0x28, 0x01,
+    0x21, 0x82, 0xDE, 0x19, 0x34, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x83, 0xED, 0x0A, 0x44, 0x91, 0xAB,
+    0x19, 0x11, 0x21, 0x02, 0xFC, 0x8A, 0x34, 0x93, 0xBC, 0x08, 0x11, 0x11, 0x13, 0xEC, 0x8B, 0x63,
+    0x02, 0xCB, 0x09, 0x11, 0x11, 0x11, 0xF9, 0x9B, 0x53, 0x03, 0xCB, 0x89, 0x11, 0x11, 0x12, 0xF8,
+    0xAB, 0x52, 0x04, 0xC9, 0x89, 0x11, 0x10, 0x11, 0xC8, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11,
+    0x22, 0xD0, 0xAF, 0x40, 0x23, 0xC9, 0x9A, 0x11, 0x01, 0x22, 0xB0, 0xCF, 0x38, 0x25, 0xB8, 0x9B,
+    0x10, 0x02, 0x22, 0xA1, 0xDF, 0x28, 0x24, 0xB0, 0xAB, 0x10, 0x12, 0x31, 0xA2, 0xDF, 0x19, 0x25,
+    0xA1, 0x9C, 0x18, 0x01, 0x21, 0x81, 0xDD, 0x19, 0x34, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x83, 0xED,
+    0x1A, 0x53, 0x91, 0xAB, 0x19, 0x11, 0x21, 0x02, 0xFC, 0x8A, 0x44, 0x81, 0xBB, 0x19, 0x11, 0x11,
+    0x13, 0xEC, 0x8C, 0x53, 0x82, 0xCA, 0x09, 0x11, 0x10, 0x12, 0xEA, 0x9B, 0x72, 0x02, 0xBA, 0x0A,
+    0x11, 0x11, 0x12, 0xE9, 0x9D, 0x51, 0x12, 0xBA, 0x0B, 0x11, 0x11, 0x32, 0xE9, 0xAD, 0x41, 0x14,
+    0xB9, 0x9B, 0x21, 0x11, 0x22, 0xD0, 0xAE, 0x48, 0x24, 0xB9, 0x9B, 0x11, 0x02, 0x32, 0xC0, 0xBF,
+    0x30, 0x25, 0xB8, 0xAB, 0x20, 0x12, 0x31, 0xC2, 0xBF, 0x39, 0x26, 0xA0, 0x9C, 0x00, 0x11, 0x21,
+    0xA1, 0xCE, 0x29, 0x35, 0xA0, 0xAC, 0x10, 0x01, 0x21, 0x81, 0xCE, 0x19, 0x44, 0x90, 0xAB, 0x29,
+    0x11, 0x11, 0x83, 0xCE, 0x1B, 0x54, 0x91, 0xAB, 0x19, 0x11, 0x21, 0x02, 0xFC, 0x8A, 0x44, 0x81,
+    0xBB, 0x19, 0x11, 0x11, 0x13, 0xEC, 0x9B, 0x54, 0x82, 0xBB, 0x09, 0x21, 0x10, 0x13, 0xFA, 0x9C,
+    0x52, 0x03, 0xBB, 0x0B, 0x12, 0x11, 0x23, 0xFA, 0x9D, 0x51, 0x12, 0xBA, 0x0B, 0x11, 0x11, 0x22,
+    0xE8, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11, 0x22, 0xD0, 0xAE, 0x30, 0x16, 0xB8, 0x8B, 0x10,
+    0x11, 0x22, 0xB0, 0xCF, 0x38, 0x25, 0xB8, 0xAB, 0x11, 0x11, 0x22, 0xA1, 0xDF, 0x28, 0x34, 0xB8,
+    0xAB, 0x10, 0x12, 0x31, 0xA2, 0xEF, 0x18, 0x43, 0xA0, 0xAB, 0x18, 0x12, 0x21, 0x92, 0xCF, 0x1A,
+    0x35, 0xA1, 0xBB, 0x18, 0x12, 0x21, 0x83, 0xCF, 0x1B, 0x54, 0x91, 0xAB, 0x19, 0x11, 0x21, 0x02,
+    0xFC, 0x8A, 0x34, 0x93, 0xBC, 0x19, 0x11, 0x11, 0x13, 0xEC, 0x8B, 0x63, 0x02, 0xCB, 0x09, 0x11,
+    0x11, 0x11, 0xF9, 0x9B, 0x53, 0x03, 0xCB, 0x89, 0x11, 0x11, 0x12, 0xF8, 0xAB, 0x52, 0x04, 0xC9,
+    0x89, 0x11, 0x00, 0x12, 0xC8, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11, 0x32, 0xD8, 0xAF, 0x40,
+    0x23, 0xC9, 0x9A, 0x11, 0x01, 0x22, 0xB0, 0xCF, 0x38, 0x25, 0xB8, 0x9B, 0x10, 0x02, 0x22, 0xA1,
+    0xDF, 0x28, 0x24, 0xA0, 0x9C, 0x18, 0x11, 0x21, 0x91, 0xBF, 0x29, 0x35, 0xA0, 0xAC, 0x10, 0x01,
+    0x21, 0x82, 0xDE, 0x19, 0x34, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x83, 0xED, 0x1A, 0x53, 0x91, 0xAB,
+    0x19, 0x11, 0x21, 0x02, 0xFC, 0x0B, 0x44, 0x81, 0xBB, 0x19, 0x11, 0x21, 0x12, 0xFB, 0x8D, 0x52,
+    0x82, 0xBA, 0x0A, 0x12, 0x10, 0x13, 0xFA, 0x9C, 0x52, 0x02, 0xBA, 0x8A, 0x12, 0x11, 0x23, 0xFA,
+    0xAC, 0x52, 0x03, 0xC9, 0x8A, 0x11, 0x01, 0x22, 0xD8, 0xAD, 0x41, 0x14, 0xC9, 0x8A, 0x11, 0x01,
+    0x21, 0xC0, 0xBD, 0x50, 0x23, 0xB9, 0x9C, 0x11, 0x11, 0x21, 0xC1, 0xBE, 0x48, 0x24, 0xB8, 0xAB,
+    0x20, 0x12, 0x31, 0xC2, 0xBF, 0x39, 0x26, 0xA0, 0x9C, 0x28, 0x10, 0x21, 0xA1, 0xCE, 0x29, 0x35,
+    0xA0, 0xAC, 0x10, 0x01, 0x21, 0x81, 0xCE, 0x19, 0x44, 0x90, 0xAB, 0x19, 0x12, 0x21, 0x82, 0xDE,
+    0x1A, 0x34, 0x92, 0xBC, 0x08, 0x12, 0x20, 0x12, 0xED, 0x8A, 0x44, 0x81, 0xBB, 0x08, 0x11, 0x21,
+    0x12, 0xFB, 0x8D, 0x52, 0x82, 0xBA, 0x0A, 0x12, 0x20, 0x12, 0xFA, 0x8C, 0x51, 0x02, 0xBA, 0x0A,
+    0x11, 0x11, 0x22, 0xF9, 0x9C, 0x51, 0x03, 0xBA, 0x8B, 0x12, 0x11, 0x23, 0xF8, 0x9D, 0x40, 0x04,
+    0xB8, 0x8B, 0x11, 0x11, 0x21, 0xC0, 0xAF, 0x30, 0x25, 0xB9, 0x9B, 0x11, 0x11, 0x22, 0xC1, 0xBF,
+    0x30, 0x25, 0xB8, 0xAB, 0x11, 0x02, 0x32, 0xB1, 0xEF, 0x28, 0x24, 0xB0, 0xAB, 0x10, 0x02, 0x22,
+    0xA2, 0xDF, 0x29, 0x34, 0xA0, 0xAC, 0x10, 0x11, 0x20, 0x92, 0xDD, 0x1A, 0x35, 0xA1, 0xAC, 0x18,
+    0x11, 0x11, 0x02, 0xDD, 0x0A, 0x44, 0x92, 0xAC, 0x08, 0x11, 0x11, 0x02, 0xDC, 0x8B, 0x45, 0x81,
+    0xBB, 0x19, 0x11, 0x11, 0x03, 0xFB, 0x8C, 0x53, 0x82, 0xBB, 0x1A, 0x11, 0x21, 0x22, 0xFB, 0x8D,
+    0x51, 0x02, 0xBA, 0x8A, 0x12, 0x11, 0x22, 0xF9, 0x9C, 0x51, 0x03, 0xBA, 0x8B, 0x21, 0x11, 0x32,
+    0xE9, 0xAD, 0x50, 0x23, 0xCA, 0x8A, 0x20, 0x01, 0x22, 0xD0, 0xBD, 0x50, 0x23, 0xB9, 0x9C, 0x11,
+    0x11, 0x21, 0xC1, 0xBE, 0x48, 0x24, 0xB8, 0xAB, 0x11, 0x02, 0x32, 0xB1, 0xDF, 0x39, 0x34, 0xB0,
+    0xAC, 0x10, 0x11, 0x21, 0xA2, 0xCF, 0x29, 0x25, 0xA0, 0xAB, 0x28, 0x11, 0x21, 0x82, 0xCF, 0x1A,
+    0x35, 0xA1, 0xBB, 0x29, 0x11, 0x22, 0x02, 0xCF, 0x1B, 0x54, 0x91, 0xAB, 0x19, 0x11, 0x21, 0x02,
+    0xFC, 0x8A, 0x34, 0x93, 0xBC, 0x08, 0x11, 0x11, 0x03, 0xFB, 0x8C, 0x53, 0x82, 0xBB, 0x09, 0x11,
+    0x21, 0x12, 0xFA, 0x8D, 0x51, 0x02, 0xBA, 0x0A, 0x11, 0x11, 0x12, 0xE9, 0x9D, 0x51, 0x12, 0xBA,
+    0x8B, 0x12, 0x11, 0x32, 0xE9, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11, 0x22, 0xD0, 0xBE, 0x50,
+    0x23, 0xC9, 0x9A, 0x11, 0x01, 0x22, 0xB0, 0xCF, 0x20, 0x25, 0xB8, 0x9B, 0x10, 0x02, 0x22, 0xB1,
+    0xCF, 0x39, 0x25, 0xB0, 0xAB, 0x10, 0x12, 0x21, 0x92, 0xDF, 0x29, 0x34, 0xA0, 0xAC, 0x18, 0x02,
+    0x21, 0x92, 0xCE, 0x1A, 0x35, 0x91, 0xAC, 0x08, 0x02, 0x21, 0x82, 0xDD, 0x0A, 0x54, 0x91, 0xAB,
+    0x19, 0x11, 0x11, 0x03, 0xDD, 0x0B, 0x44, 0x82, 0xCB, 0x19, 0x11, 0x10, 0x12, 0xFB, 0x8B, 0x63,
+    0x82, 0xCA, 0x09, 0x11, 0x10, 0x12, 0xF9, 0x8B, 0x52, 0x83, 0xCA, 0x89, 0x11, 0x11, 0x12, 0xE9,
+    0x9C, 0x51, 0x03, 0xC9, 0x8A, 0x11, 0x11, 0x21, 0xD8, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11,
+    0x22, 0xD0, 0xAE, 0x48, 0x24, 0xB9, 0x9B, 0x11, 0x11, 0x32, 0xC0, 0xBF, 0x30, 0x25, 0xB8, 0xAB,
+    0x20, 0x12, 0x31, 0xB1, 0xEF, 0x28, 0x24, 0xB0, 0xAB, 0x10, 0x02, 0x22, 0xA2, 0xDF, 0x29, 0x34,
+    0xA0, 0xAC, 0x10, 0x11, 0x20, 0x92, 0xDD, 0x1A, 0x35, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x02, 0xDD,
+    0x0A, 0x44, 0x92, 0xAC, 0x08, 0x11, 0x11, 0x02, 0xDC, 0x8B, 0x45, 0x81, 0xBB, 0x19, 0x11, 0x11,
+    0x13, 0xEC, 0x9B, 0x54, 0x82, 0xBB, 0x09, 0x21, 0x20, 0x12, 0xFA, 0x9C, 0x52, 0x83, 0xBA, 0x8A,
+    0x12, 0x11, 0x23, 0xFA, 0x9D, 0x51, 0x12, 0xBA, 0x8A, 0x11, 0x11, 0x22, 0xE8, 0xAD, 0x41, 0x14,
+    0xB9, 0x9B, 0x21, 0x11, 0x31, 0xD0, 0xAE, 0x30, 0x16, 0xB8, 0x8B, 0x10, 0x11, 0x31, 0xB0, 0xCF,
+    0x38, 0x25, 0xB8, 0x9B, 0x10, 0x11, 0x22, 0xB1, 0xCF, 0x39, 0x25, 0xB0, 0xAB, 0x10, 0x12, 0x31,
+    0xA2, 0xDF, 0x19, 0x25, 0xA1, 0x9C, 0x18, 0x01, 0x21, 0x81, 0xDD, 0x19, 0x34, 0xA1, 0xAC, 0x18,
+    0x11, 0x11, 0x83, 0xED, 0x1A, 0x53, 0x91, 0xBB, 0x18, 0x11, 0x21, 0x12, 0xED, 0x8A, 0x44, 0x92,
+    0xBB, 0x19, 0x11, 0x21, 0x12, 0xFB, 0x8D, 0x52, 0x82, 0xBA, 0x0A, 0x21, 0x20, 0x12, 0xFA, 0x9C,
+    0x52, 0x83, 0xBA, 0x8A, 0x12, 0x11, 0x13, 0xF9, 0xAC, 0x52, 0x03, 0xC9, 0x8A, 0x11, 0x01, 0x22,
+    0xD8, 0xAD, 0x50, 0x13, 0xC9, 0x8A, 0x11, 0x01, 0x22, 0xC8, 0xBE, 0x50, 0x23, 0xC9, 0x9A, 0x11,
+    0x01, 0x22, 0xB0, 0xCF, 0x20, 0x25, 0xB8, 0x9B, 0x10, 0x02, 0x22, 0xB1, 0xCF, 0x39, 0x25, 0xB0,
+    0xAB, 0x10, 0x12, 0x31, 0x91, 0xDF, 0x29, 0x34, 0xA0, 0xAC, 0x28, 0x01, 0x21, 0x92, 0xCE, 0x1A,
+    0x35, 0x91, 0xAC, 0x19, 0x02, 0x21, 0x82, 0xDD, 0x0A, 0x54, 0x91, 0xAB, 0x19, 0x11, 0x11, 0x03,
+    0xFC, 0x0A, 0x53, 0x81, 0xBB, 0x19, 0x11, 0x11, 0x13, 0xEC, 0x8C, 0x53, 0x82, 0xCA, 0x09, 0x11,
+    0x10, 0x12, 0xEA, 0x9B, 0x72, 0x02, 0xBA, 0x0A, 0x11, 0x11, 0x12, 0xE9, 0x9D, 0x51, 0x12, 0xBA,
+    0x0B, 0x11, 0x11, 0x32, 0xE9, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11, 0x22, 0xD0, 0xAE, 0x48,
+    0x24, 0xB9, 0x9B, 0x11, 0x02, 0x32, 0xC0, 0xBF, 0x30, 0x25, 0xB8, 0xAB, 0x11, 0x12, 0x31, 0xB1,
+    0xEF, 0x28, 0x24, 0xB0, 0xAB, 0x10, 0x02, 0x22, 0xA2, 0xDF, 0x29, 0x34, 0xA0, 0xAC, 0x10, 0x11,
+    0x20, 0x92, 0xED, 0x19, 0x34, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x82, 0xFC, 0x1A, 0x53, 0x91, 0xBB,
+    0x18, 0x11, 0x21, 0x02, 0xFC, 0x8A, 0x34, 0x93, 0xBC, 0x19, 0x11, 0x21, 0x12, 0xEC, 0x9B, 0x54,
+    0x82, 0xBB, 0x09, 0x21, 0x20, 0x12, 0xFA, 0x9C, 0x52, 0x03, 0xBB, 0x0B, 0x12, 0x11, 0x23, 0xFA,
+    0x9D, 0x51, 0x12, 0xBA, 0x0B, 0x11, 0x11, 0x22, 0xE8, 0xAD, 0x41, 0x14, 0xB9, 0x8B, 0x20, 0x11,
+    0x31, 0xD0, 0xAE, 0x30, 0x16, 0xB8, 0x8B, 0x10, 0x11, 0x31, 0xB0, 0xCF, 0x38, 0x25, 0xB8, 0x9B,
+    0x10, 0x11, 0x22, 0xB1, 0xCF, 0x39, 0x35, 0xB8, 0xAB, 0x10, 0x12, 0x31, 0x91, 0xEF, 0x18, 0x43,
+    0xA0, 0xAB, 0x18, 0x12, 0x21, 0x92, 0xCF, 0x1A, 0x35, 0xA1, 0xBB, 0x18, 0x12, 0x21, 0x83, 0xCF,
+    0x1B, 0x54, 0x91, 0xAB, 0x19, 0x11, 0x21, 0x02, 0xFC, 0x8A, 0x34, 0x93, 0xBC, 0x08, 0x11, 0x11,
+    0x03, 0xFB, 0x8C, 0x53, 0x82, 0xBB, 0x09, 0x11, 0x21, 0x22, 0xFB, 0x8D, 0x51, 0x02, 0xBA, 0x8A,
+    0x12, 0x11, 0x22, 0xEA, 0x9D, 0x51, 0x03, 0xBA, 0x8B, 0x12, 0x11, 0x32, 0xE9, 0xAD, 0x41, 0x14,
+    0xB9, 0x9B, 0x21, 0x11, 0x22, 0xD0, 0xAF, 0x40, 0x23, 0xC9, 0x9A, 0x11, 0x01, 0x22, 0xB0, 0xCF,
+    0x38, 0x25, 0xB8, 0x9B, 0x10, 0x02, 0x22, 0xB1, 0xCF, 0x39, 0x25, 0xB0, 0xAB, 0x10, 0x12, 0x31,
+    0x91, 0xDF, 0x29, 0x34, 0xA0, 0xAC, 0x18, 0x02, 0x21, 0x92, 0xED, 0x19, 0x34, 0xA1, 0xAC, 0x18,
+    0x11, 0x20, 0x02, 0xED, 0x1A, 0x53, 0x91, 0xAB, 0x19, 0x11, 0x21, 0x02, 0xFC, 0x8A, 0x44, 0x81,
+    0xBB, 0x09, 0x12, 0x11, 0x13, 0xEC, 0x8C, 0x53, 0x82, 0xCA, 0x09, 0x11, 0x10, 0x12, 0xF9, 0x8B,
+    0x52, 0x83, 0xCA, 0x89, 0x11, 0x11, 0x12, 0xE9, 0x9C, 0x51, 0x03, 0xC9, 0x8A, 0x11, 0x11, 0x21,
+    0xD8, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11, 0x22, 0xD0, 0xBE, 0x40, 0x24, 0xB9, 0x9B, 0x11,
+    0x02, 0x32, 0xC0, 0xBF, 0x30, 0x25, 0xB8, 0xAB, 0x20, 0x12, 0x31, 0xC2, 0xBF, 0x39, 0x26, 0xA0,
+    0x9C, 0x00, 0x11, 0x21, 0xA1, 0xCE, 0x29, 0x35, 0xA0, 0xAC, 0x10, 0x01, 0x21, 0x81, 0xCE, 0x19,
+    0x44, 0x90, 0xAB, 0x29, 0x11, 0x11, 0x83, 0xCE, 0x1B, 0x54, 0x91, 0xAB, 0x19, 0x11, 0x21, 0x02,
+    0xFC, 0x8A, 0x44, 0x81, 0xBB, 0x19, 0x11, 0x11, 0x03, 0xFB, 0x8C, 0x62, 0x82, 0xBA, 0x0A, 0x12,
+    0x10, 0x13, 0xFA, 0x8C, 0x51, 0x02, 0xBA, 0x0A, 0x11, 0x11, 0x22, 0xF9, 0x9C, 0x51, 0x03, 0xBA,
+    0x8B, 0x12, 0x11, 0x23, 0xF8, 0xAC, 0x50, 0x04, 0xA9, 0x8B, 0x11, 0x11, 0x21, 0xC0, 0xAF, 0x30,
+    0x25, 0xB9, 0x9B, 0x11, 0x11, 0x22, 0xC1, 0xBF, 0x30, 0x25, 0xB8, 0xAB, 0x11, 0x02, 0x32, 0xB1,
+    0xEF, 0x28, 0x24, 0xB0, 0xAB, 0x10, 0x02, 0x22, 0xA2, 0xDF, 0x18, 0x34, 0xA0, 0xAC, 0x10, 0x01,
+    0x21, 0x92, 0xDD, 0x1A, 0x35, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x02, 0xDD, 0x0A, 0x44, 0x81, 0xAC,
+    0x08, 0x02, 0x11, 0x02, 0xDC, 0x0B, 0x44, 0x82, 0xAC, 0x09, 0x11, 0x11, 0x12, 0xFB, 0x9B, 0x44,
+    0x83, 0xCB, 0x09, 0x11, 0x11, 0x12, 0xFA, 0xAB, 0x63, 0x83, 0xBA, 0x8A, 0x12, 0x11, 0x22, 0xF9,
+    0xAC, 0x52, 0x03, 0xC9, 0x8A, 0x11, 0x01, 0x22, 0xD8, 0x9E, 0x40, 0x13, 0xC9, 0x8A, 0x20, 0x10,
+    0x22, 0xD0, 0xBD, 0x50, 0x23, 0xB9, 0x9C, 0x11, 0x11, 0x21, 0xB0, 0xCF, 0x20, 0x25, 0xB8, 0x9B,
+    0x20, 0x01, 0x22, 0xA1, 0xDF, 0x28, 0x24, 0xB0, 0xAB, 0x10, 0x12, 0x31, 0xA2, 0xDF, 0x19, 0x25,
+    0xA1, 0x9C, 0x18, 0x01, 0x21, 0x81, 0xDD, 0x19, 0x34, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x83, 0xED,
+    0x1A, 0x53, 0x91, 0xAB, 0x19, 0x11, 0x21, 0x12, 0xED, 0x8A, 0x44, 0x81, 0xBB, 0x19, 0x11, 0x21,
+    0x12, 0xFB, 0x8D, 0x52, 0x82, 0xBA, 0x0A, 0x12, 0x10, 0x13, 0xFA, 0x9C, 0x52, 0x83, 0xBA, 0x8A,
+    0x12, 0x11, 0x13, 0xF9, 0xAC, 0x52, 0x03, 0xBA, 0x8B, 0x12, 0x11, 0x23, 0xF8, 0x9D, 0x40, 0x14,
+    0xB9, 0x8B, 0x11, 0x11, 0x21, 0xD0, 0xBD, 0x50, 0x23, 0xC8, 0x9B, 0x11, 0x11, 0x31, 0xB0, 0xCF,
+    0x38, 0x25, 0xB8, 0xAB, 0x11, 0x11, 0x22, 0xB2, 0xDF, 0x28, 0x34, 0xB8, 0xBB, 0x20, 0x12, 0x31,
+    0xA2, 0xEF, 0x29, 0x24, 0x90, 0xAC, 0x10, 0x01, 0x21, 0x81, 0xCE, 0x19, 0x44, 0x90, 0xBB, 0x18,
+    0x12, 0x21, 0x82, 0xDE, 0x1A, 0x34, 0x92, 0xBC, 0x08, 0x12, 0x20, 0x12, 0xDD, 0x8B, 0x45, 0x81,
+    0xBB, 0x19, 0x11, 0x11, 0x13, 0xEC, 0x9B, 0x54, 0x82, 0xBB, 0x09, 0x21, 0x20, 0x12, 0xFA, 0x9C,
+    0x52, 0x03, 0xBB, 0x0B, 0x12, 0x11, 0x23, 0xFA, 0x9D, 0x51, 0x12, 0xBA, 0x0B, 0x11, 0x11, 0x22,
+    0xE8, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11, 0x22, 0xD0, 0xAE, 0x30, 0x16, 0xB8, 0x8B, 0x10,
+    0x11, 0x22, 0xB0, 0xCF, 0x38, 0x25, 0xB8, 0xAB, 0x11, 0x02, 0x22, 0xA1, 0xDF, 0x28, 0x34, 0xB8,
+    0xAB, 0x10, 0x12, 0x31, 0xA2, 0xEF, 0x29, 0x24, 0xA0, 0xAB, 0x18, 0x12, 0x21, 0x82, 0xCF, 0x1A,
+    0x35, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x02, 0xDD, 0x0A, 0x44, 0x92, 0xAC, 0x08, 0x11, 0x11, 0x02,
+    0xDC, 0x0B, 0x44, 0x82, 0xAC, 0x09, 0x11, 0x11, 0x12, 0xFB, 0x9B, 0x44, 0x83, 0xCB, 0x09, 0x11,
+    0x11, 0x12, 0xFA, 0x8C, 0x42, 0x03, 0xCB, 0x0A, 0x11, 0x11, 0x22, 0xF9, 0xAB, 0x52, 0x04, 0xC9,
+    0x89, 0x11, 0x00, 0x12, 0xC8, 0xAD, 0x41, 0x14, 0xB9, 0x9B, 0x21, 0x11, 0x32, 0xD8, 0xAF, 0x40,
+    0x23, 0xC9, 0x9A, 0x11, 0x01, 0x22, 0xB0, 0xCF, 0x38, 0x25, 0xB8, 0x9B, 0x10, 0x02, 0x22, 0xA1,
+    0xDF, 0x28, 0x24, 0xA0, 0x9C, 0x18, 0x11, 0x21, 0x91, 0xBF, 0x29, 0x35, 0xA0, 0xAC, 0x10, 0x01,
+    0x21, 0x82, 0xDE, 0x19, 0x34, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x83, 0xED, 0x1A, 0x53, 0x91, 0xAB,
+    0x19, 0x11, 0x21, 0x12, 0xED, 0x8A, 0x44, 0x81, 0xBB, 0x19, 0x11, 0x21, 0x12, 0xFB, 0x8D, 0x52,
+    0x82, 0xBA, 0x0A, 0x12, 0x20, 0x12, 0xFA, 0x9C, 0x52, 0x83, 0xBA, 0x8A, 0x12, 0x11, 0x22, 0xF9,
+    0xAC, 0x52, 0x03, 0xC9, 0x8A, 0x11, 0x01, 0x22, 0xD8, 0xAD, 0x41, 0x14, 0xC9, 0x8A, 0x11, 0x01,
+    0x21, 0xC0, 0xAE, 0x40, 0x23, 0xC8, 0x9B, 0x11, 0x11, 0x31, 0xB0, 0xDF, 0x20, 0x24, 0xB8, 0xAB,
+    0x11, 0x02, 0x32, 0xB1, 0xDF, 0x28, 0x34, 0xB8, 0xBB, 0x20, 0x12, 0x31, 0xA2, 0xEF, 0x29, 0x24,
+    0xB1, 0xAB, 0x18, 0x12, 0x21, 0x93, 0xDF, 0x19, 0x34, 0xA1, 0xAC, 0x18, 0x11, 0x11, 0x02, 0xDD,
+    0x1B, 0x54, 0x91, 0xAB, 0x19, 0x11, 0x11, 0x12, 0xDD, 0x8A, 0x44, 0x82, 0xAC, 0x09, 0x02, 0x11,
+    0x12, 0xFB, 0x8B, 0x63, 0x82, 0xCA, 0x09, 0x11, 0x10, 0x12, 0xF9, 0x8B, 0x52, 0x83, 0xCA, 0x89,
+    0x21, 0x10, 0x12, 0xE9, 0x9C, 0x51, 0x03, 0xC9, 0x8A, 0x11, 0x11, 0x21, 0xD8, 0xAD, 0x41, 0x14,
+    0xC9, 0x8A, 0x11, 0x01, 0x21, 0xC0, 0xBD, 0x50, 0x23, 0xB9, 0x9C, 0x11, 0x11, 0x21, 0xC1, 0xBE,
+    0x48, 0x24, 0xB8, 0xAB, 0x20, 0x12, 0x31, 0xB1, 0xEF, 0x28, 0x24, 0xB0, 0xAB, 0x10, 0x02, 0x22,
+    0xA2, 0xDF, 0x29, 0x34, 0xA0, 0xAC, 0x10, 0x11, 0x20, 0x92, 0xDD, 0x1A, 0x35, 0xA1, 0xBB, 0x29,
+    0x11, 0x31, 0x02, 0xCF, 0x0A, 0x44, 0x92, 0xAC, 0x08, 0x02, 0x11, 0x01, 0xFB, 0x8A, 0x44, 0x81,
+    0xBB, 0x08, 0x11, 0x11, 0x12, 0xFB, 0x9B, 0x44, 0x02, 0xCB, 0x09, 0x11, 0x01, 0x12, 0xF9, 0x8B,
+    0x52, 0x83, 0xCA, 0x09, 0x10, 0x11, 0x21, 0xD9, 0x9D, 0x51, 0x02, 0xB9, 0x8A, 0x11, 0x11, 0x21,
+    0xD8, 0xAD, 0x41, 0x14, 0xAA, 0x8B, 0x11, 0x11, 0x21, 0xD0, 0xBC, 0x50, 0x23, 0xB9, 0x9C, 0x11,
+    0x11, 0x21, 0xB0, 0xBF, 0x30, 0x25, 0xB8, 0x9B, 0x10, 0x11, 0x21, 0xB1, 0xCE, 0x28, 0x25, 0xA8,
+    0xAA, 0x10, 0x11, 0x20, 0x90, 0xCC, 0x29, 0x34, 0xA0, 0xAB, 0x10, 0x01, 0x01, 0x80, 0xAA, 0x10,
+};
+
+const AudioClip_t kAudioClips[AUDIO_CLIP_COUNT] = {
+    [AUDIO_CLIP_ALERT] = { kClip_alert, 6400u },
+    [AUDIO_CLIP_CHIME] = { kClip_chime, 4800u },
+};
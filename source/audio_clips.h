@@ -0,0 +1,21 @@
+#ifndef AUDIO_CLIPS_H_
+#define AUDIO_CLIPS_H_
+
+#include <stdint.h>
+
+// IMA ADPCM, 8 kHz mono, two samples per byte (low nibble first).
+// Regenerate audio_clips.c with tools/wav2adpcm.py.
+typedef enum {
+    AUDIO_CLIP_ALERT = 0,
+    AUDIO_CLIP_CHIME,
+    AUDIO_CLIP_COUNT
+} AudioClipId_t;
+
+typedef struct {
+    const uint8_t *adpcm;
+    uint32_t samples;
+} AudioClip_t;
+
+extern const AudioClip_t kAudioClips[AUDIO_CLIP_COUNT];
+
+#endif /* AUDIO_CLIPS_H_ */
@@ -0,0 +1,314 @@
+/*
+ * @file    audio_player.c
+ * @brief   Sampled-audio playback: ADPCM clips -> DAC0, DMA paced by TPM2
+ *
+ * TPM2 overflows at AUDIO_SAMPLE_RATE_HZ and each overflow raises a DMA
+ * request that moves one 12-bit sample from RAM into DAC0. Two buffers are
+ * used ping-pong: while DMA drains one, Audio_Task decodes the next block
+ * of the clip into the other. The CPU only runs once per buffer (32 ms).
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "board.h"
+#include "fsl_common.h"
+#include "fsl_clock.h"
+#include "fsl_device_registers.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "audio_clips.h"
+#include "audio_player.h"
+#include "low_power.h"
+#include "pwm_service.h"
+#include "trace_recorder.h"
+
+#define DAC_OUT_PTE30      30u   // DAC0_OUT on PTE30 (analog, ALT0)
+#define AUDIO_DMA_CH       0u
+#define AUDIO_DMAMUX_SRC   56u   // DMAMUX request source: TPM2 overflow
+#define AUDIO_DMA_PRIO     64u
+#define DAC_MIDSCALE       2048u
+#define SILENCE_SAMPLES    16u
+
+#define NOTIFY_REFILL      (1u << 0)
+#define NOTIFY_PLAY        (1u << 1)
+#define NOTIFY_STOP        (1u << 2)
+
+#define HALF_SILENCE       2u    // activeHalf value while the silence buffer plays
+
+static uint16_t pcmBuffer[2][AUDIO_BUFFER_SAMPLES];
+static const uint16_t kSilence[SILENCE_SAMPLES] = {
+    DAC_MIDSCALE, DAC_MIDSCALE, DAC_MIDSCALE, DAC_MIDSCALE,
+    DAC_MIDSCALE, DAC_MIDSCALE, DAC_MIDSCALE, DAC_MIDSCALE,
+    DAC_MIDSCALE, DAC_MIDSCALE, DAC_MIDSCALE, DAC_MIDSCALE,
+    DAC_MIDSCALE, DAC_MIDSCALE, DAC_MIDSCALE, DAC_MIDSCALE,
+};
+
+// Shared with DMA0_IRQHandler.
+static volatile bool bufferReady[2];
+static volatile uint8_t activeHalf;   // buffer the DMA is draining (or HALF_SILENCE)
+static volatile uint8_t nextHalf;     // buffer to chain after it
+static volatile bool clipDone;        // decoder has no more samples
+static volatile bool playing;
+static volatile uint32_t underruns;
+
+static TaskHandle_t audioTaskHandle;
+static TPM_Type *pacingTimer;            // TPM2, reserved from the PWM service
+static volatile AudioClipId_t requestedClip;
+
+// IMA ADPCM decoder state (Audio_Task only).
+static const AudioClip_t *clip;
+static uint32_t clipPos;
+static int32_t predictor;
+static int32_t stepIndex;
+
+static const int8_t kIndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static const uint16_t kStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209,
+    230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876,
+    963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749,
+    3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385,
+    24623, 27086, 29794, 32767
+};
+
+/* -------------------- DAC / TPM2 / DMA -------------------- */
+static void dac_init(void) {
+    SIM->SCGC5 |= SIM_SCGC5_PORTE_MASK;
+    SIM->SCGC6 |= SIM_SCGC6_DAC0_MASK;
+    PORTE->PCR[DAC_OUT_PTE30] = (PORTE->PCR[DAC_OUT_PTE30] & ~PORT_PCR_MUX_MASK) | PORT_PCR_MUX(0);
+
+    DAC0->C1 = 0;                                   // buffer off: DAT[0] drives the output
+    DAC0->C0 = DAC_C0_DACEN_MASK | DAC_C0_DACRFS_MASK; // VDDA reference
+    DAC0->DAT[0].DATL = (uint8_t)(DAC_MIDSCALE & 0xFFu);
+    DAC0->DAT[0].DATH = (uint8_t)(DAC_MIDSCALE >> 8);
+}
+
+static void pacing_timer_init(void) {
+    // TPM2 is not PWM here: take the whole timer from the PWM service.
+    pacingTimer = PWM_ReserveTimer(PWM_TPM2);
+    configASSERT(pacingTimer != NULL);
+
+    pacingTimer->SC  = 0;
+    pacingTimer->CNT = 0;
+    pacingTimer->MOD = (PWM_GetTimerClockHz() / AUDIO_SAMPLE_RATE_HZ) - 1u;
+}
+
+static void dma_init(void) {
+    SIM->SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
+    SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
+
+    DMAMUX0->CHCFG[AUDIO_DMA_CH] = 0;
+    DMAMUX0->CHCFG[AUDIO_DMA_CH] = DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_SOURCE(AUDIO_DMAMUX_SRC);
+
+    NVIC_SetPriority(DMA0_IRQn, AUDIO_DMA_PRIO);
+    NVIC_ClearPendingIRQ(DMA0_IRQn);
+    NVIC_EnableIRQ(DMA0_IRQn);
+}
+
+// One 16-bit transfer per TPM2 overflow; ERQ drops at the end of the block
+// (D_REQ) and the completion interrupt chains the next block.
+static void dma_arm(const uint16_t *src, uint32_t samples) {
+    DMA0->DMA[AUDIO_DMA_CH].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+    DMA0->DMA[AUDIO_DMA_CH].SAR = (uint32_t)src;
+    DMA0->DMA[AUDIO_DMA_CH].DAR = (uint32_t)&DAC0->DAT[0].DATL;
+    DMA0->DMA[AUDIO_DMA_CH].DSR_BCR = DMA_DSR_BCR_BCR(samples * sizeof(uint16_t));
+    DMA0->DMA[AUDIO_DMA_CH].DCR = DMA_DCR_EINT_MASK | DMA_DCR_ERQ_MASK | DMA_DCR_CS_MASK |
+                                  DMA_DCR_SINC_MASK | DMA_DCR_SSIZE(2) | DMA_DCR_DSIZE(2) |
+                                  DMA_DCR_D_REQ_MASK;
+}
+
+static void playback_halt(void) {
+    pacingTimer->SC = 0;
+    DMA0->DMA[AUDIO_DMA_CH].DCR = 0;
+    DMA0->DMA[AUDIO_DMA_CH].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+    DAC0->DAT[0].DATL = (uint8_t)(DAC_MIDSCALE & 0xFFu);
+    DAC0->DAT[0].DATH = (uint8_t)(DAC_MIDSCALE >> 8);
+    playing = false;
+    LowPower_Release(LOW_POWER_HOLD_AUDIO);
+}
+
+void DMA0_IRQHandler(void) {
+    BaseType_t hpw = pdFALSE;
+    TraceRecorder_IsrEnter();
+    uint32_t status = DMA0->DMA[AUDIO_DMA_CH].DSR_BCR;
+
+    DMA0->DMA[AUDIO_DMA_CH].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+    if (status & (DMA_DSR_BCR_CE_MASK | DMA_DSR_BCR_BES_MASK | DMA_DSR_BCR_BED_MASK)) {
+        playback_halt();
+        TraceRecorder_IsrExit();
+        return;
+    }
+
+    if (activeHalf != HALF_SILENCE) {
+        bufferReady[activeHalf] = false;
+    }
+
+    if (bufferReady[nextHalf]) {
+        activeHalf = nextHalf;
+        nextHalf ^= 1u;
+        dma_arm(pcmBuffer[activeHalf], AUDIO_BUFFER_SAMPLES);
+    } else if (clipDone) {
+        playback_halt();
+    } else {
+        // Decoder fell behind: hold the output at midscale instead of
+        // replaying stale samples, and try again after the short gap.
+        underruns++;
+        activeHalf = HALF_SILENCE;
+        dma_arm(kSilence, SILENCE_SAMPLES);
+    }
+
+    if (audioTaskHandle != NULL) {
+        xTaskNotifyFromISR(audioTaskHandle, NOTIFY_REFILL, eSetBits, &hpw);
+    }
+    TraceRecorder_IsrExit();
+    portYIELD_FROM_ISR(hpw);
+}
+
+/* -------------------- ADPCM DECODE -------------------- */
+static void decoder_reset(AudioClipId_t id) {
+    clip = &kAudioClips[id];
+    clipPos = 0;
+    predictor = 0;
+    stepIndex = 0;
+}
+
+// Decodes up to count samples as 12-bit DAC codes, padding with midscale.
+// Returns the number of real samples produced (0 once the clip is over).
+static uint32_t decode_block(uint16_t *out, uint32_t count) {
+    uint32_t produced = 0;
+
+    while (produced < count && clipPos < clip->samples) {
+        uint8_t byte = clip->adpcm[clipPos >> 1];
+        uint8_t code = (clipPos & 1u) ? (uint8_t)(byte >> 4) : (uint8_t)(byte & 0x0Fu);
+        int32_t step = kStepTable[stepIndex];
+        int32_t delta = step >> 3;
+
+        if (code & 4u) delta += step;
+        if (code & 2u) delta += step >> 1;
+        if (code & 1u) delta += step >> 2;
+        predictor += (code & 8u) ? -delta : delta;
+        if (predictor > 32767) predictor = 32767;
+        else if (predictor < -32768) predictor = -32768;
+
+        stepIndex += kIndexTable[code];
+        if (stepIndex < 0) stepIndex = 0;
+        else if (stepIndex > 88) stepIndex = 88;
+
+        out[produced++] = (uint16_t)((predictor + 32768) >> 4);
+        clipPos++;
+    }
+    for (uint32_t i = produced; i < count; ++i) {
+        out[i] = DAC_MIDSCALE;
+    }
+    return produced;
+}
+
+static void refill_free_halves(void) {
+    for (int n = 0; n < 2; ++n) {
+        taskENTER_CRITICAL();
+        uint8_t half = (n == 0) ? nextHalf : (uint8_t)(nextHalf ^ 1u);
+        bool busy = bufferReady[half] || (half == activeHalf) || clipDone;
+        taskEXIT_CRITICAL();
+        if (busy) {
+            continue;
+        }
+
+        if (decode_block(pcmBuffer[half], AUDIO_BUFFER_SAMPLES) == 0u) {
+            clipDone = true;
+        } else {
+            bufferReady[half] = true;
+        }
+    }
+}
+
+static void playback_start(AudioClipId_t id) {
+    taskENTER_CRITICAL();
+    playback_halt();
+    taskEXIT_CRITICAL();
+    decoder_reset(id);
+
+    bufferReady[0] = false;
+    bufferReady[1] = false;
+    clipDone = false;
+    activeHalf = HALF_SILENCE;
+    nextHalf = 0;
+    refill_free_halves();
+    if (!bufferReady[0]) {
+        return; // empty clip
+    }
+
+    taskENTER_CRITICAL();
+    LowPower_Hold(LOW_POWER_HOLD_AUDIO);   // TPM2/DMA stop in VLPS
+    activeHalf = 0;
+    nextHalf = 1;
+    playing = true;
+    dma_arm(pcmBuffer[0], AUDIO_BUFFER_SAMPLES);
+    pacingTimer->CNT = 0;
+    pacingTimer->SC = TPM_SC_DMA_MASK | TPM_SC_CMOD(1); // prescaler 1, DMA request on overflow
+    taskEXIT_CRITICAL();
+}
+
+/* -------------------- PUBLIC API -------------------- */
+void Audio_Init(void) {
+    memset(pcmBuffer, 0, sizeof(pcmBuffer));
+    underruns = 0;
+    playing = false;
+    activeHalf = HALF_SILENCE;
+    nextHalf = 0;
+
+    dac_init();
+    pacing_timer_init();
+    dma_init();
+}
+
+void Audio_Play(AudioClipId_t id) {
+    if (id >= AUDIO_CLIP_COUNT || audioTaskHandle == NULL) {
+        return;
+    }
+    requestedClip = id;
+    xTaskNotify(audioTaskHandle, NOTIFY_PLAY, eSetBits);
+}
+
+void Audio_Stop(void) {
+    if (audioTaskHandle != NULL) {
+        xTaskNotify(audioTaskHandle, NOTIFY_STOP, eSetBits);
+    }
+}
+
+bool Audio_IsPlaying(void) {
+    return playing;
+}
+
+uint32_t Audio_GetUnderruns(void) {
+    return underruns;
+}
+
+// Low priority on purpose: a refill has a whole buffer period (32 ms) of slack.
+void Audio_Task(void *pvParameters) {
+    (void)pvParameters;
+    uint32_t events = 0;
+
+    audioTaskHandle = xTaskGetCurrentTaskHandle();
+    for (;;) {
+        xTaskNotifyWait(0u, UINT32_MAX, &events, portMAX_DELAY);
+
+        if (events & NOTIFY_STOP) {
+            taskENTER_CRITICAL();
+            playback_halt();
+            taskEXIT_CRITICAL();
+        }
+        if (events & NOTIFY_PLAY) {
+            playback_start(requestedClip);
+        } else if ((events & NOTIFY_REFILL) && playing) {
+            refill_free_halves();
+        }
+    }
+}
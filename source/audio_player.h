@@ -0,0 +1,22 @@
+#ifndef AUDIO_PLAYER_H_
+#define AUDIO_PLAYER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+#include "audio_clips.h"
+
+#define AUDIO_SAMPLE_RATE_HZ   8000u
+#define AUDIO_BUFFER_SAMPLES   256u   // per half of the ping-pong buffer (32 ms)
+
+void Audio_Init(void);
+// Starts (or restarts) a clip. Non-blocking; safe to call from any task.
+void Audio_Play(AudioClipId_t clip);
+void Audio_Stop(void);
+bool Audio_IsPlaying(void);
+uint32_t Audio_GetUnderruns(void);
+void Audio_Task(void *pvParameters);
+
+#endif /* AUDIO_PLAYER_H_ */
@@ -0,0 +1,37 @@
+/*
+ * @file    cmd_token.c
+ * @brief   Whitespace tokens and case-insensitive compare for text commands
+ */
+
+#include <ctype.h>
+
+#include "cmd_token.h"
+
+bool CmdToken_Next(const char **cursor, char *tok, size_t len) {
+    const char *p = *cursor;
+    size_t n = 0;
+    bool fits = true;
+    while (*p && isspace((unsigned char)*p)) p++;
+    while (*p && !isspace((unsigned char)*p)) {
+        if (n + 1u < len) tok[n++] = *p;
+        else fits = false;
+        p++;
+    }
+    if (!fits) n = 0;
+    tok[n] = '\0';
+    *cursor = p;
+    return n > 0u;
+}
+
+bool CmdToken_AtEnd(const char *cursor) {
+    while (*cursor && isspace((unsigned char)*cursor)) cursor++;
+    return *cursor == '\0';
+}
+
+bool CmdToken_Equals(const char *a, const char *b) {
+    while (*a != '\0' && tolower((unsigned char)*a) == tolower((unsigned char)*b)) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
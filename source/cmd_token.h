@@ -0,0 +1,22 @@
+#ifndef CMD_TOKEN_H_
+#define CMD_TOKEN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Tokenising for the text commands the ESP32 forwards (TH/PRED/RULE..., LOG).
+// Only <ctype.h> is used: Redlib has no <strings.h>, so no strcasecmp.
+
+// Copies the next whitespace-separated token of *cursor into tok and
+// advances the cursor past it. False if none is left, or if it does not fit
+// in len - 1 characters (tok is then empty): a cut token is never parsed.
+bool CmdToken_Next(const char **cursor, char *tok, size_t len);
+
+// True if only whitespace is left; tells a missing optional argument from
+// one CmdToken_Next rejected.
+bool CmdToken_AtEnd(const char *cursor);
+
+// Case-insensitive string equality.
+bool CmdToken_Equals(const char *a, const char *b);
+
+#endif /* CMD_TOKEN_H_ */
@@ -0,0 +1,114 @@
+/*
+ * @file    deadline_monitor.c
+ * @brief   Periodic task pacing with deadline, overrun and jitter accounting
+ */
+
+#include <stdbool.h>
+
+#include "board.h"
+#include "fsl_debug_console.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "deadline_monitor.h"
+#include "log.h"
+
+#define SYSTICK_CYCLES_PER_TICK   (configCPU_CLOCK_HZ / configTICK_RATE_HZ)
+#define US_PER_TICK               (1000000u / configTICK_RATE_HZ)
+#define CPU_CYCLES_PER_US         (configCPU_CLOCK_HZ / 1000000u)
+
+typedef struct {
+    TickType_t lastWake;      // xTaskDelayUntil anchor: the nominal release
+    DeadlineStat_t stat;
+} DeadlineState_t;
+
+static DeadlineState_t states[DEADLINE_COUNT] = {
+#define DEADLINE_INIT(id, period, deadline) \
+    [DEADLINE_##id] = { .stat = { .periodMs = (period), .deadlineMs = (deadline) } },
+    DEADLINE_TABLE(DEADLINE_INIT)
+#undef DEADLINE_INIT
+};
+
+// Microseconds since the start of kernel tick `since`: whole ticks from the
+// tick count, the part of the current tick from SysTick. The tick is kept
+// in step across tickless sleeps (low_power.c), so this also holds when
+// the PIT run-time clock was stopped in VLPS.
+static uint32_t us_since_tick(TickType_t since) {
+    taskENTER_CRITICAL();
+    TickType_t now = xTaskGetTickCount();
+    uint32_t left = SysTick->VAL;
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+        now++;                  // the tick expired but is not counted yet
+        left = SysTick->VAL;    // re-read: the first read may predate the reload
+    }
+    taskEXIT_CRITICAL();
+
+    // After a tickless sleep SysTick counts down a partial tick, so count
+    // from the full period rather than from LOAD.
+    uint32_t inTick = (left < SYSTICK_CYCLES_PER_TICK) ? (SYSTICK_CYCLES_PER_TICK - 1u) - left : 0u;
+    return (uint32_t)(now - since) * US_PER_TICK + inTick / CPU_CYCLES_PER_US;
+}
+
+void DeadlineMonitor_Start(DeadlineTask_t task) {
+    configASSERT(task < DEADLINE_COUNT);
+    DeadlineState_t *s = &states[task];
+    s->stat.name = pcTaskGetName(NULL);
+    s->lastWake = xTaskGetTickCount();
+}
+
+void DeadlineMonitor_WaitNext(DeadlineTask_t task) {
+    configASSERT(task < DEADLINE_COUNT);
+    DeadlineState_t *s = &states[task];
+    DeadlineStat_t *st = &s->stat;
+
+    // From the nominal release, so a late start counts against the deadline.
+    uint32_t execUs = us_since_tick(s->lastWake);
+    bool newWorst = execUs > st->wcetUs;
+    bool miss = execUs > st->deadlineMs * 1000u;
+
+    taskENTER_CRITICAL();
+    st->cycles++;
+    st->lastExecUs = execUs;
+    if (newWorst) {
+        st->wcetUs = execUs;
+    }
+    if (miss) {
+        st->misses++;
+    }
+    taskEXIT_CRITICAL();
+
+    if (miss && newWorst) {
+        LOG_WARN(DEADLINE, "%s miss %u us (deadline %u ms)\r\n", st->name, (unsigned)execUs,
+                 (unsigned)st->deadlineMs);
+    }
+
+    if (xTaskDelayUntil(&s->lastWake, pdMS_TO_TICKS(st->periodMs)) == pdFALSE) {
+        // Released late: restart the period from now instead of catching up.
+        taskENTER_CRITICAL();
+        st->overruns++;
+        taskEXIT_CRITICAL();
+        s->lastWake = xTaskGetTickCount();
+        return;
+    }
+
+    // lastWake is now this cycle's nominal release.
+    uint32_t latencyUs = us_since_tick(s->lastWake);
+    if (latencyUs > st->jitterUs) {
+        taskENTER_CRITICAL();
+        st->jitterUs = latencyUs;
+        taskEXIT_CRITICAL();
+    }
+}
+
+uint8_t DeadlineMonitor_Get(DeadlineStat_t *out, uint8_t max) {
+    uint8_t n = 0;
+    taskENTER_CRITICAL();
+    for (uint8_t i = 0; i < DEADLINE_COUNT && n < max; ++i) {
+        if (states[i].stat.name != NULL) {
+            out[n++] = states[i].stat;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return n;
+}
@@ -0,0 +1,56 @@
+#ifndef DEADLINE_MONITOR_H_
+#define DEADLINE_MONITOR_H_
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+// Period and deadline bookkeeping for the periodic tasks. Each task calls
+// DeadlineMonitor_Start once, then DeadlineMonitor_WaitNext at the end of
+// every cycle instead of vTaskDelay. Releases are paced with
+// xTaskDelayUntil from a fixed anchor, so they do not drift by the
+// execution time.
+//
+// Per cycle (kernel tick plus SysTick, microsecond resolution):
+//   exec     nominal release -> WaitNext (response time: release latency,
+//            preemption and execution)
+//   miss     exec > deadline
+//   overrun  the next release had already passed when WaitNext ran. The
+//            cycle is skipped and the anchor restarts from now, so a late
+//            task does not catch up with a burst of back-to-back cycles.
+//   jitter   nominal release -> task running again, worst case
+// A miss that sets a new worst-case exec time is printed as
+//     DEADLINE <task> miss <exec-us> us (deadline <ms> ms)
+// and every counter is in the STATS report (STAT dl ...).
+
+// X(id, periodMs, deadlineMs). The timer-driven work (plant logic, DHT
+// poll) runs in the event hub, which tracks its own deadlines.
+#define DEADLINE_TABLE(X)            \
+    X(Sensor,    200u,   100u)
+
+typedef enum {
+#define DEADLINE_ENUM(id, period, deadline) DEADLINE_##id,
+    DEADLINE_TABLE(DEADLINE_ENUM)
+#undef DEADLINE_ENUM
+    DEADLINE_COUNT
+} DeadlineTask_t;
+
+typedef struct {
+    const char *name;        // name of the task that called Start (NULL before)
+    uint32_t periodMs;
+    uint32_t deadlineMs;
+    uint32_t cycles;
+    uint32_t misses;
+    uint32_t overruns;
+    uint32_t wcetUs;         // worst exec time
+    uint32_t lastExecUs;
+    uint32_t jitterUs;       // worst release latency
+} DeadlineStat_t;
+
+void DeadlineMonitor_Start(DeadlineTask_t task);
+void DeadlineMonitor_WaitNext(DeadlineTask_t task);
+
+// Copies up to max entries (table order); returns the number copied.
+uint8_t DeadlineMonitor_Get(DeadlineStat_t *out, uint8_t max);
+
+#endif /* DEADLINE_MONITOR_H_ */
@@ -0,0 +1,249 @@
+/*
+ * @file    dht11.c
+ * @brief   On-chip DHT11 reader: GPIO start pulse, TPM1 input capture
+ *
+ * The DHT11 answers the start pulse with 80 us low / 80 us high, then 40
+ * bits, each a 50 us low followed by a 26-28 us (0) or 70 us (1) high, and
+ * finally pulls low for 50 us and releases the line. TPM1_CH0 captures the
+ * counter on every edge; the frame's last edge is that release, so the 80
+ * edges before it are the 40 rising/falling pairs of the data bits.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "fsl_device_registers.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "dht11.h"
+#include "log.h"
+#include "low_power.h"
+#include "pwm_service.h"
+#include "sensor.h"
+#include "trace_recorder.h"
+
+#if (DHT11_LOCAL_ENABLE > 0)
+
+#define DHT11_PIN_PTA      12u    // PTA12: GPIO (ALT1) for the start pulse, TPM1_CH0 (ALT3) to capture
+#define DHT11_TPM_CH       0u
+#define DHT11_TPM_INT_PRIO 0u     // each capture must be read before the next edge (>= 26 us)
+#define DHT11_TICK_MAX_HZ  2000000u  // prescale TPM1 to at most this: the 16-bit counter spans > 30 ms
+
+#define DHT11_START_MS     20u    // host start pulse (>= 18 ms)
+#define DHT11_FRAME_MS     8u     // the answer takes ~5 ms
+#define DHT11_QUIET_TICKS  2u     // no edge for a whole tick: the frame is over
+#define DHT11_MAX_EDGES    96u
+#define DHT11_DATA_EDGES   80u
+#define DHT11_MIN_EDGES    (DHT11_DATA_EDGES + 3u)  // response low/high + data + release
+#define DHT11_BIT_ONE_US   48u    // high longer than this is a 1
+#define DHT11_BIT_MAX_US   100u   // longer high: not a data bit
+
+static TPM_Type *captureTimer;          // TPM1, reserved from the PWM service
+static uint8_t prescale;
+static uint32_t oneTicks;
+static uint32_t maxTicks;
+
+// Shared with TPM1_IRQHandler.
+static volatile uint16_t edges[DHT11_MAX_EDGES];
+static volatile uint8_t edgeCount;
+static TaskHandle_t readerTask;         // notified from the last few edges on
+
+static Dht11Stats_t stats;
+static TickType_t lastOkTick;
+static bool haveReading;
+
+/* -------------------- TPM1 CAPTURE -------------------- */
+static void capture_timer_init(void) {
+    // TPM1 is not PWM here: take the whole timer from the PWM service.
+    captureTimer = PWM_ReserveTimer(PWM_TPM1);
+    configASSERT(captureTimer != NULL);
+
+    uint32_t clockHz = PWM_GetTimerClockHz();
+    prescale = 0;
+    while (prescale < 7u && (clockHz >> prescale) > DHT11_TICK_MAX_HZ) {
+        prescale++;
+    }
+    uint32_t tickHz = clockHz >> prescale;
+    oneTicks = (tickHz / 1000u) * DHT11_BIT_ONE_US / 1000u;
+    maxTicks = (tickHz / 1000u) * DHT11_BIT_MAX_US / 1000u;
+
+    captureTimer->SC = 0;
+    captureTimer->MOD = 0xFFFFu;
+
+    NVIC_SetPriority(TPM1_IRQn, DHT11_TPM_INT_PRIO);
+    NVIC_ClearPendingIRQ(TPM1_IRQn);
+    NVIC_EnableIRQ(TPM1_IRQn);
+}
+
+static void pin_drive_low(void) {
+    PORTA->PCR[DHT11_PIN_PTA] = PORT_PCR_MUX(1) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+    GPIOA->PCOR = (1u << DHT11_PIN_PTA);
+    GPIOA->PDDR |= (1u << DHT11_PIN_PTA);
+}
+
+// Releases the line (pull-up) straight into capture on both edges.
+static void capture_start(void) {
+    taskENTER_CRITICAL();
+    edgeCount = 0;
+    captureTimer->SC = 0;
+    captureTimer->CONTROLS[DHT11_TPM_CH].CnSC = 0;
+    captureTimer->CONTROLS[DHT11_TPM_CH].CnSC =
+        TPM_CnSC_ELSA_MASK | TPM_CnSC_ELSB_MASK | TPM_CnSC_CHIE_MASK;
+    captureTimer->CNT = 0;
+    captureTimer->STATUS = TPM_STATUS_CH0F_MASK << DHT11_TPM_CH;
+    captureTimer->SC = TPM_SC_PS(prescale) | TPM_SC_CMOD(1);
+
+    GPIOA->PDDR &= ~(1u << DHT11_PIN_PTA);
+    PORTA->PCR[DHT11_PIN_PTA] = PORT_PCR_MUX(3) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+    taskEXIT_CRITICAL();
+}
+
+static void capture_stop(void) {
+    taskENTER_CRITICAL();
+    captureTimer->CONTROLS[DHT11_TPM_CH].CnSC = 0;
+    captureTimer->SC = 0;
+    captureTimer->STATUS = TPM_STATUS_CH0F_MASK << DHT11_TPM_CH;
+    taskEXIT_CRITICAL();
+}
+
+// From DHT11_MIN_EDGES on, every edge may be the frame's last: wake the
+// reader on each, and it stops once they stop (or the buffer is full).
+void TPM1_IRQHandler(void) {
+    BaseType_t hpw = pdFALSE;
+    TraceRecorder_IsrEnter();
+    uint16_t value = (uint16_t)captureTimer->CONTROLS[DHT11_TPM_CH].CnV;
+    captureTimer->STATUS = TPM_STATUS_CH0F_MASK << DHT11_TPM_CH;
+    if (edgeCount < DHT11_MAX_EDGES) {
+        edges[edgeCount++] = value;
+        if (edgeCount >= DHT11_MIN_EDGES && readerTask != NULL) {
+            vTaskNotifyGiveFromISR(readerTask, &hpw);
+        }
+    }
+    TraceRecorder_IsrExit();
+    portYIELD_FROM_ISR(hpw);
+}
+
+/* -------------------- DECODE -------------------- */
+typedef enum {
+    READ_OK,
+    READ_NO_RESPONSE,
+    READ_BAD,
+} ReadResult_t;
+
+static ReadResult_t decode_frame(float *temperature, float *humidity) {
+    uint8_t n = edgeCount;
+    if (n < DHT11_MIN_EDGES) {
+        return READ_NO_RESPONSE;
+    }
+
+    uint8_t bytes[5] = { 0 };
+    const volatile uint16_t *bit = &edges[n - 1u - DHT11_DATA_EDGES];
+    for (uint32_t i = 0; i < DHT11_DATA_EDGES / 2u; ++i, bit += 2) {
+        uint16_t high = (uint16_t)(bit[1] - bit[0]);   // counter wraps at 0xFFFF
+        if (high > maxTicks) {
+            return READ_BAD;
+        }
+        bytes[i / 8u] = (uint8_t)((bytes[i / 8u] << 1) | (high > oneTicks ? 1u : 0u));
+    }
+    if ((uint8_t)(bytes[0] + bytes[1] + bytes[2] + bytes[3]) != bytes[4] ||
+        (bytes[0] == 0u && bytes[2] == 0u)) {
+        return READ_BAD;
+    }
+
+    // Integral and tenths; bit 7 of the temperature tenths marks below zero.
+    *humidity = (float)bytes[0] + (float)bytes[1] * 0.1f;
+    float t = (float)bytes[2];
+    if (bytes[3] & 0x80u) {
+        t = -1.0f - t;
+    }
+    *temperature = t + (float)(bytes[3] & 0x0Fu) * 0.1f;
+    return READ_OK;
+}
+
+// A delay of n ticks lasts between n - 1 and n tick periods: the start
+// pulse gets one tick more so it never falls short of 18 ms. The frame wait
+// ends on the capture interrupt; its timeout (>= 10 ms at 200 Hz) only
+// matters when no sensor answers.
+static ReadResult_t read_sensor(float *temperature, float *humidity) {
+    pin_drive_low();
+    vTaskDelay(pdMS_TO_TICKS(DHT11_START_MS) + 1u);
+
+    LowPower_Hold(LOW_POWER_HOLD_DHT);   // TPM1 stops in VLPS
+    (void)ulTaskNotifyTake(pdTRUE, 0);   // nothing left from the last read
+    capture_start();
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DHT11_FRAME_MS) + 2u) != 0u) {
+        while (ulTaskNotifyTake(pdTRUE, DHT11_QUIET_TICKS) != 0u) {
+        }
+    }
+    capture_stop();
+    LowPower_Release(LOW_POWER_HOLD_DHT);
+
+    return decode_frame(temperature, humidity);
+}
+
+/* -------------------- PUBLIC API -------------------- */
+void Dht11_Init(void) {
+    SIM->SCGC5 |= SIM_SCGC5_PORTA_MASK;
+    PORTA->PCR[DHT11_PIN_PTA] = PORT_PCR_MUX(1) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+    GPIOA->PDDR &= ~(1u << DHT11_PIN_PTA);   // idle: released, pulled up
+
+    memset(&stats, 0, sizeof(stats));
+    haveReading = false;
+    capture_timer_init();
+}
+
+bool Dht11_IsFresh(void) {
+    return haveReading && (xTaskGetTickCount() - lastOkTick) < pdMS_TO_TICKS(DHT11_FRESH_MS);
+}
+
+void Dht11_GetStats(Dht11Stats_t *out) {
+    taskENTER_CRITICAL();
+    *out = stats;
+    out->ageMs = haveReading ? (uint32_t)((xTaskGetTickCount() - lastOkTick) * portTICK_PERIOD_MS)
+                             : UINT32_MAX;
+    taskEXIT_CRITICAL();
+}
+
+void Dht11_Task(void *pvParameters) {
+    (void)pvParameters;
+    TickType_t wake = xTaskGetTickCount();
+    ReadResult_t last = READ_OK;
+
+    readerTask = xTaskGetCurrentTaskHandle();
+
+    for (;;) {
+        // Also covers the sensor's ~1 s settling time after power-up.
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(DHT11_PERIOD_MS));
+
+        float temperature;
+        float humidity;
+        ReadResult_t result = read_sensor(&temperature, &humidity);
+
+        taskENTER_CRITICAL();
+        stats.reads++;
+        if (result == READ_OK) {
+            stats.ok++;
+            lastOkTick = xTaskGetTickCount();
+            haveReading = true;
+        } else if (result == READ_BAD) {
+            stats.bad++;
+        } else {
+            stats.noResponse++;
+        }
+        taskEXIT_CRITICAL();
+
+        if (result == READ_OK) {
+            Sensor_UpdateRemoteReadings(temperature, humidity);
+            LOG_DEBUG(SENSOR, "DHT11 -> temp: %.1f C, humidity: %.1f %%\r\n", temperature, humidity);
+        } else if (result != last) {
+            // Once per change, not every period with no sensor fitted.
+            LOG_WARN(SENSOR, "DHT11 read failed (%s)\r\n",
+                     result == READ_BAD ? "bad frame" : "no response");
+        }
+        last = result;
+    }
+}
+
+#endif /* DHT11_LOCAL_ENABLE */
@@ -0,0 +1,54 @@
+#ifndef DHT11_H_
+#define DHT11_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+// DHT11 read directly by the MCXC on PTA12 (TPM1_CH0). The task drives the
+// 18 ms start pulse as GPIO (sleeping through it), then hands the pin to
+// TPM1 in input capture on both edges. The ISR only stores the captured
+// counter values; the task decodes the frame once it is over and passes
+// the reading to Sensor_UpdateRemoteReadings. Nothing busy-waits.
+//
+// While local readings are fresh the bridge no longer asks the ESP32 for
+// GET_DHT; without a sensor on PTA12 the reads fail and it falls back to
+// the ESP32 as before.
+
+#ifndef DHT11_LOCAL_ENABLE
+#ifdef RTOS_BENCH
+#define DHT11_LOCAL_ENABLE   0   // TPM1 belongs to the benchmark (rtos_bench.h)
+#else
+#define DHT11_LOCAL_ENABLE   1
+#endif
+#endif
+
+#define DHT11_PERIOD_MS      2000u                    // DHT11: at most ~1 Hz
+#define DHT11_FRESH_MS       (3u * DHT11_PERIOD_MS)   // older: poll the ESP32 again
+
+typedef struct {
+    uint32_t reads;
+    uint32_t ok;
+    uint32_t bad;          // checksum or pulse-width error
+    uint32_t noResponse;   // too few edges: no sensor, or it did not answer
+    uint32_t ageMs;        // since the last good reading; UINT32_MAX if none
+} Dht11Stats_t;
+
+#if (DHT11_LOCAL_ENABLE > 0)
+
+// Reserves TPM1 from the PWM service; call after PWM_Init and Sensors_Init.
+void Dht11_Init(void);
+void Dht11_Task(void *pvParameters);
+// A good local reading within the last DHT11_FRESH_MS.
+bool Dht11_IsFresh(void);
+void Dht11_GetStats(Dht11Stats_t *out);
+
+#else
+
+#define Dht11_Init()        ((void)0)
+#define Dht11_IsFresh()     (false)
+
+#endif /* DHT11_LOCAL_ENABLE */
+
+#endif /* DHT11_H_ */
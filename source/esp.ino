@@ -2,70 +2,252 @@
 #include <Adafruit_SSD1306.h>
 #include <Arduino.h>
 #include <ArduinoJson.h>
-#include <DHT.h>
+#include <driver/gpio.h>
+#include <driver/rmt_rx.h>
+#include <driver/uart.h>
+#include <atomic>
 
 // ================== Pin / HW config ==================
 #define DHT_PIN 4
-#define DHT_TYPE DHT11
+#define DHT_RMT_RES_HZ 1000000 // 1 us per RMT tick
+#define DHT_RMT_SYMBOLS 48     // one RMT memory block; a frame is ~43 words
+#define DHT_BIT_ONE_US 50      // data high pulse longer than this is a 1
 #define UART_RX_PIN 2 // ESP32 RX  <- FRDM TX (PTE22)
 #define UART_TX_PIN 1 // ESP32 TX  -> FRDM RX (PTE23)
+#define MCXC_UART UART_NUM_1
+#define MCXC_BAUD 9600
+#define MCXC_RX_BUF 1024   // driver ring; lines are parsed out of it
+#define MCXC_TX_BUF 256
+#define MCXC_EVENT_QUEUE 16
+#define MCXC_LINE_MAX 200  // longer lines are dropped
 
 #define I2C_SDA 6
 #define I2C_SCL 7
 #define OLED_ADDR 0x3C
 #define SCREEN_W 128
 #define SCREEN_H 64
+#define OLED_MIN_PERIOD_MS 100 // refresh cap (10 Hz)
+#define OLED_I2C_CHUNK 31      // data bytes per I2C write, after the 0x40 control byte
+
+// The MCXC link runs on one core, DHT sampling, the display and the USB
+// console (Arduino's loop()) on the other. Single-core parts run it all on 0.
+#if portNUM_PROCESSORS > 1
+#define PROTO_CORE 0
+#define APP_CORE 1
+#else
+#define PROTO_CORE 0
+#define APP_CORE 0
+#endif
 
 // ================== Globals ==================
-DHT dht(DHT_PIN, DHT_TYPE);
-Adafruit_SSD1306 display(SCREEN_W, SCREEN_H, &Wire, -1);
+// 400 kHz during and after the library's own transfers, so the partial
+// updates oledTask writes straight to Wire run at the same speed.
+Adafruit_SSD1306 display(SCREEN_W, SCREEN_H, &Wire, -1, 400000UL, 400000UL);
 
-String uartLine; // accumulates chars until '\n'
-float dhtTemp = NAN, dhtHum = NAN;
-int photoVal = -1, waterVal = -1;
+String usbLine;  // operator commands typed on the USB console
+QueueHandle_t mcxcUartEvents;
+rmt_channel_handle_t dhtRx;
+QueueHandle_t dhtRxDone;   // RMT receive-done events, from the ISR callback
+rmt_symbol_word_t dhtSymbols[DHT_RMT_SYMBOLS];
 
-unsigned long lastDhtReadMs = 0;         // last successful DHT sample time
-unsigned long lastMcxcUpdateMs = 0;      // last time we got JSON from MCXC
+uint32_t dhtErrors = 0;                  // failed DHT frames (timeout/checksum)
+uint32_t mcxcLines = 0, mcxcDropped = 0; // UART lines parsed / lost
 const uint32_t DHT_MIN_PERIOD_MS = 1500; // DHT11 spec ~1 Hz; be gentle
 
-// ================== Helpers ==================
-static inline void oledPrintLine(uint8_t x, uint8_t y, const char *fmt, ...) {
-  char buf[32];
-  va_list ap;
-  va_start(ap, fmt);
-  vsnprintf(buf, sizeof(buf), fmt, ap);
-  va_end(ap);
+// ================== Cross-core queues ==================
+// Single-producer/single-consumer ring. Each side only writes its own index,
+// so neither needs a lock, even with producer and consumer on different
+// cores. A full ring drops the new entry and counts it.
+template <typename T, uint32_t N> struct SpscRing {
+  static_assert((N & (N - 1)) == 0, "N must be a power of two");
+  T slot[N];
+  std::atomic<uint32_t> head{0}, tail{0};
+  uint32_t drops = 0;
+
+  // All of v[0..n) or nothing.
+  bool push(const T *v, uint32_t n) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (N - (h - tail.load(std::memory_order_acquire)) < n) {
+      drops++;
+      return false;
+    }
+    for (uint32_t i = 0; i < n; ++i)
+      slot[(h + i) & (N - 1)] = v[i];
+    head.store(h + n, std::memory_order_release);
+    return true;
+  }
+  bool push(const T &v) { return push(&v, 1); }
+  bool pop(T *v) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire))
+      return false;
+    *v = slot[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+// Latest-value slot (seqlock) for one writer and readers on the other core.
+// The writer bumps seq to odd, copies, then to even; a reader retries until
+// it saw the same even seq on both sides of its copy. Nothing queues, so a
+// reader always gets the newest value and the writer never drops one.
+template <typename T> struct LatestSlot {
+  T value;
+  std::atomic<uint32_t> seq{0};
+
+  void store(const T &v) {
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    value = v;
+    seq.store(s + 2, std::memory_order_release);
+  }
+  // False until the first store.
+  bool load(T *v) const {
+    uint32_t s0, s1;
+    do {
+      s0 = seq.load(std::memory_order_acquire);
+      if (s0 == 0)
+        return false;
+      *v = value;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      s1 = seq.load(std::memory_order_relaxed);
+    } while ((s0 & 1u) || s0 != s1);
+    return true;
+  }
+};
+
+struct DhtSample {
+  float temp, hum;
+  uint32_t atMs;
+};
+
+// One JSON frame from the MCXC; -1 marks a field the frame did not carry.
+struct McxcSample {
+  int photo, water, cpuIdle;
+  char cpuTop[12];
+  uint32_t atMs;
+};
+
+LatestSlot<DhtSample> dhtLatest;    // dhtTask -> mcxcUartTask (GET_DHT)
+SpscRing<DhtSample, 4> dhtToView;   // dhtTask -> oledTask
+SpscRing<McxcSample, 8> mcxcToView; // mcxcUartTask -> oledTask
+SpscRing<char, 2048> protoLog;      // mcxcUartTask -> USB console (loop())
+
+// ================== Task timing ==================
+// Wall time per pass of each task's loop, including any waits inside it (the
+// DHT start pulse, I2C). Written only by the task itself and read unlocked
+// by the TASKS command, so a printed line may mix two passes.
+struct TaskTiming {
+  const char *name;
+  TaskHandle_t handle;
+  int core;
+  uint32_t runs, maxUs;
+  uint64_t totalUs;
+};
+
+enum { TIMING_UART, TIMING_DHT, TIMING_OLED, TIMING_USB, TIMING_COUNT };
+TaskTiming taskTiming[TIMING_COUNT] = {
+    {"mcxc_uart"}, {"dht"}, {"oled"}, {"usb"},
+};
+
+void timingRecord(int id, uint32_t startUs) {
+  TaskTiming &t = taskTiming[id];
+  uint32_t us = micros() - startUs;
+  t.core = xPortGetCoreID();
+  t.runs++;
+  t.totalUs += us;
+  if (us > t.maxUs)
+    t.maxUs = us;
+}
+
+// ================== OLED ==================
+// Retained view: the text of every field as last sent to the panel. oledTask
+// rebuilds it from the samples it has been sent and does nothing if no field
+// changed.
+// Otherwise it redraws the framebuffer in RAM and sends, per 8-row SSD1306
+// page, only the column span that differs from oledPanel (a copy of what the
+// panel holds), using page/column addressing instead of a full 1 KB push.
+struct OledView {
+  char cpu[24];
+  char photo[16];
+  char water[16];
+  char dht[20];
+  char age[28];
+  bool smile;
+};
+
+TaskHandle_t oledTaskHandle;
+OledView oledShown;
+uint8_t oledPanel[SCREEN_W * SCREEN_H / 8];
+uint32_t oledFlushes = 0, oledBytes = 0; // partial updates / data bytes sent
+
+// What oledTask knows, merged from the DHT and MCXC rings.
+struct ViewState {
+  float dhtTemp = NAN, dhtHum = NAN;
+  int photoVal = -1, waterVal = -1, cpuIdle = -1;
+  char cpuTopTask[12] = "";
+  uint32_t lastDhtReadMs = 0;    // last successful DHT sample time
+  uint32_t lastMcxcUpdateMs = 0; // last time we got JSON from MCXC
+};
+
+// A sample was queued: redraw at the next allowed refresh.
+void oledKick() {
+  if (oledTaskHandle)
+    xTaskNotifyGive(oledTaskHandle);
+}
+
+void buildView(const ViewState &st, OledView *v) {
+  if (st.cpuIdle >= 0)
+    snprintf(v->cpu, sizeof(v->cpu), "idle%d%% %.7s", st.cpuIdle, st.cpuTopTask);
+  if (st.photoVal >= 0)
+    snprintf(v->photo, sizeof(v->photo), "Photo: %d", st.photoVal);
+  else
+    snprintf(v->photo, sizeof(v->photo), "Photo: --");
+  if (st.waterVal >= 0)
+    snprintf(v->water, sizeof(v->water), "Water: %d", st.waterVal);
+  else
+    snprintf(v->water, sizeof(v->water), "Water: --");
+  if (!isnan(st.dhtTemp) && !isnan(st.dhtHum))
+    snprintf(v->dht, sizeof(v->dht), "%.1fC %.1f%%", st.dhtTemp, st.dhtHum);
+  else
+    snprintf(v->dht, sizeof(v->dht), "--.-C --.-%%");
+  v->smile = !isnan(st.dhtTemp) && st.dhtTemp > 20.0f;
+
+  // Ages (seconds since last updates) — small hint for freshness
+  uint32_t now = millis();
+  uint32_t ageDht =
+      (st.lastDhtReadMs ? (now - st.lastDhtReadMs) / 1000 : 9999);
+  uint32_t ageMcxc =
+      (st.lastMcxcUpdateMs ? (now - st.lastMcxcUpdateMs) / 1000 : 9999);
+  snprintf(v->age, sizeof(v->age), "Age DHT:%lus MCXC:%lus",
+           (unsigned long)ageDht, (unsigned long)ageMcxc);
+}
+
+static inline void oledText(uint8_t x, uint8_t y, const char *s) {
   display.setCursor(x, y);
-  display.print(buf);
+  display.print(s);
 }
 
-void drawOLED() {
+void drawView(const OledView &v) {
   display.clearDisplay();
   display.setTextColor(SSD1306_WHITE);
   display.setTextSize(1);
 
   // Header
-  oledPrintLine(0, 0, "Smart Plant Monitor");
+  oledText(0, 0, "Smart Plant Monitor");
 
   // MCXC sensor block
-  oledPrintLine(0, 12, "MCXC:");
-  if (photoVal >= 0)
-    oledPrintLine(12, 24, "Photo: %d", photoVal);
-  else
-    oledPrintLine(12, 24, "Photo: --");
-  if (waterVal >= 0)
-    oledPrintLine(12, 36, "Water: %d", waterVal);
-  else
-    oledPrintLine(12, 36, "Water: --");
+  oledText(0, 12, "MCXC:");
+  oledText(36, 12, v.cpu);
+  oledText(12, 24, v.photo);
+  oledText(12, 36, v.water);
 
   // ESP32 sensor block
-  oledPrintLine(0, 48, "ESP32:");
-  if (!isnan(dhtTemp) && !isnan(dhtHum))
-    oledPrintLine(48, 48, "%.1fC %.1f%%", dhtTemp, dhtHum);
-  else
-    oledPrintLine(48, 48, "--.-C --.-%%");
+  oledText(0, 48, "ESP32:");
+  oledText(48, 48, v.dht);
 
-  if (!isnan(dhtTemp) && dhtTemp > 20.0f) {
+  if (v.smile) {
     int16_t centerX = 104;
     int16_t centerY = 24;
     int16_t radius = 10;
@@ -79,95 +261,459 @@ void drawOLED() {
     }
   }
 
-  // Ages (seconds since last updates) — small hint for freshness
-  uint32_t now = millis();
-  uint32_t ageDht = (lastDhtReadMs ? (now - lastDhtReadMs) / 1000 : 9999);
-  uint32_t ageMcxc =
-      (lastMcxcUpdateMs ? (now - lastMcxcUpdateMs) / 1000 : 9999);
-  display.setTextSize(1);
-  oledPrintLine(0, 56, "Age DHT:%lus MCXC:%lus", (unsigned long)ageDht,
-                (unsigned long)ageMcxc);
+  oledText(0, 56, v.age);
+}
 
-  display.display();
+void oledSendSpan(uint8_t page, uint8_t c0, uint8_t c1, const uint8_t *data) {
+  display.ssd1306_command(SSD1306_PAGEADDR);
+  display.ssd1306_command(page);
+  display.ssd1306_command(page);
+  display.ssd1306_command(SSD1306_COLUMNADDR);
+  display.ssd1306_command(c0);
+  display.ssd1306_command(c1);
+  size_t n = c1 - c0 + 1;
+  while (n > 0) {
+    size_t chunk = n < OLED_I2C_CHUNK ? n : OLED_I2C_CHUNK;
+    Wire.beginTransmission(OLED_ADDR);
+    Wire.write((uint8_t)0x40); // data stream
+    Wire.write(data, chunk);
+    Wire.endTransmission();
+    data += chunk;
+    n -= chunk;
+  }
 }
 
-void sendDhtJson() {
-  // Rate-limit DHT reads to avoid hammering the sensor
-  uint32_t now = millis();
-  if (now - lastDhtReadMs >= DHT_MIN_PERIOD_MS || isnan(dhtTemp) ||
-      isnan(dhtHum)) {
-    float t = dht.readTemperature();
-    float h = dht.readHumidity();
-    if (!isnan(t) && !isnan(h)) {
-      dhtTemp = t;
-      dhtHum = h;
-      lastDhtReadMs = now;
+// Sends the differing span of each page; returns the data bytes sent.
+uint32_t oledFlushDirty() {
+  const uint8_t *fb = display.getBuffer();
+  uint32_t sent = 0;
+  for (uint8_t page = 0; page < SCREEN_H / 8; ++page) {
+    const uint8_t *row = fb + page * SCREEN_W;
+    uint8_t *shown = oledPanel + page * SCREEN_W;
+    int c0 = 0;
+    while (c0 < SCREEN_W && row[c0] == shown[c0])
+      c0++;
+    if (c0 == SCREEN_W)
+      continue;
+    int c1 = SCREEN_W - 1;
+    while (row[c1] == shown[c1])
+      c1--;
+    oledSendSpan(page, c0, c1, row + c0);
+    memcpy(shown + c0, row + c0, c1 - c0 + 1);
+    sent += c1 - c0 + 1;
+  }
+  return sent;
+}
+
+// Owns the display (and Wire) after setup().
+void oledTask(void *arg) {
+  ViewState st;
+  for (;;) {
+    // A new sample, or a second later for the age line.
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+    uint32_t start = micros();
+
+    DhtSample d;
+    while (dhtToView.pop(&d)) {
+      st.dhtTemp = d.temp;
+      st.dhtHum = d.hum;
+      st.lastDhtReadMs = d.atMs;
     }
+    McxcSample m;
+    while (mcxcToView.pop(&m)) {
+      // Tolerate missing fields (keep last if missing)
+      if (m.photo >= 0)
+        st.photoVal = m.photo;
+      if (m.water >= 0)
+        st.waterVal = m.water;
+      if (m.cpuIdle >= 0) {
+        st.cpuIdle = m.cpuIdle;
+        memcpy(st.cpuTopTask, m.cpuTop, sizeof(st.cpuTopTask));
+      }
+      st.lastMcxcUpdateMs = m.atMs;
+    }
+
+    OledView v = {};
+    buildView(st, &v);
+    if (memcmp(&v, &oledShown, sizeof(v)) != 0) {
+      drawView(v);
+      oledBytes += oledFlushDirty();
+      oledFlushes++;
+      oledShown = v;
+    }
+    timingRecord(TIMING_OLED, start);
+    vTaskDelay(pdMS_TO_TICKS(OLED_MIN_PERIOD_MS));
   }
+}
+
+void mcxcWrite(const char *s) {
+  // The driver serialises writers, so loop() and the UART task can both send.
+  uart_write_bytes(MCXC_UART, s, strlen(s));
+}
+
+// Debug output from the UART task. It goes through protoLog to loop(), so a
+// slow or absent USB host never stalls the MCXC link. Lines that do not fit
+// are dropped whole.
+void protoLogf(const char *fmt, ...) {
+  char buf[MCXC_LINE_MAX + 32];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n > 0)
+    protoLog.push(buf, n < (int)sizeof(buf) ? n : sizeof(buf) - 1);
+}
+
+// ================== DHT11 over RMT ==================
+// The DHT11 answers an 18 ms low start pulse with 80 us low / 80 us high, then
+// 40 bits, each a 50 us low followed by a 26-28 us (0) or 70 us (1) high. The
+// RMT receiver timestamps those edges, so nothing bit-bangs the protocol with
+// interrupts masked; dhtTask samples in the background and GET_DHT answers
+// from the cached reading.
+
+static bool IRAM_ATTR dhtRxDoneIsr(rmt_channel_handle_t ch,
+                                   const rmt_rx_done_event_data_t *ev,
+                                   void *ctx) {
+  BaseType_t woken = pdFALSE;
+  xQueueSendFromISR(dhtRxDone, ev, &woken);
+  return woken == pdTRUE;
+}
+
+// The data bits are the last 40 high pulses of the frame; anything before
+// them is the host release and the sensor's 80 us response.
+bool dhtDecode(const rmt_symbol_word_t *sym, size_t n, float *t, float *h) {
+  uint16_t highs[DHT_RMT_SYMBOLS * 2];
+  size_t nh = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (sym[i].level0 && sym[i].duration0 > 0 && sym[i].duration0 < 200)
+      highs[nh++] = sym[i].duration0;
+    if (sym[i].level1 && sym[i].duration1 > 0 && sym[i].duration1 < 200)
+      highs[nh++] = sym[i].duration1;
+  }
+  if (nh < 40)
+    return false;
+
+  uint8_t b[5] = {0};
+  const uint16_t *bits = &highs[nh - 40];
+  for (int i = 0; i < 40; ++i)
+    b[i / 8] = (uint8_t)((b[i / 8] << 1) | (bits[i] > DHT_BIT_ONE_US));
+  if ((uint8_t)(b[0] + b[1] + b[2] + b[3]) != b[4])
+    return false;
+
+  // Same conversion as the Adafruit DHT library for the DHT11
+  *h = b[0] + b[1] * 0.1f;
+  float temp = b[2];
+  if (b[3] & 0x80)
+    temp = -1 - temp;
+  *t = temp + (b[3] & 0x0f) * 0.1f;
+  return true;
+}
+
+bool dhtRead(float *t, float *h) {
+  rmt_receive_config_t rc = {};
+  rc.signal_range_min_ns = 1000;   // glitch filter
+  rc.signal_range_max_ns = 200000; // line idle this long ends the frame
+
+  // Start pulse: the task sleeps through it instead of spinning.
+  gpio_set_level((gpio_num_t)DHT_PIN, 0);
+  vTaskDelay(pdMS_TO_TICKS(20));
+  xQueueReset(dhtRxDone);
+  esp_err_t err = rmt_receive(dhtRx, dhtSymbols, sizeof(dhtSymbols), &rc);
+  gpio_set_level((gpio_num_t)DHT_PIN, 1); // release; the sensor answers
+  if (err != ESP_OK)
+    return false;
+
+  rmt_rx_done_event_data_t ev;
+  if (xQueueReceive(dhtRxDone, &ev, pdMS_TO_TICKS(30)) != pdTRUE) {
+    // No answer: cancel the pending receive so the next one can start.
+    rmt_disable(dhtRx);
+    rmt_enable(dhtRx);
+    return false;
+  }
+  return dhtDecode(ev.received_symbols, ev.num_symbols, t, h);
+}
+
+void dhtBegin() {
+  dhtRxDone = xQueueCreate(1, sizeof(rmt_rx_done_event_data_t));
+
+  rmt_rx_channel_config_t cfg = {};
+  cfg.gpio_num = (gpio_num_t)DHT_PIN;
+  cfg.clk_src = RMT_CLK_SRC_DEFAULT;
+  cfg.resolution_hz = DHT_RMT_RES_HZ;
+  cfg.mem_block_symbols = DHT_RMT_SYMBOLS;
+  rmt_new_rx_channel(&cfg, &dhtRx);
+  rmt_rx_event_callbacks_t cbs = {};
+  cbs.on_recv_done = dhtRxDoneIsr;
+  rmt_rx_register_event_callbacks(dhtRx, &cbs, NULL);
+  rmt_enable(dhtRx);
+
+  // The start pulse is driven on the same pad as open-drain output; the RMT
+  // input stays attached to it.
+  gpio_set_pull_mode((gpio_num_t)DHT_PIN, GPIO_PULLUP_ONLY);
+  gpio_set_level((gpio_num_t)DHT_PIN, 1);
+  gpio_set_direction((gpio_num_t)DHT_PIN, GPIO_MODE_INPUT_OUTPUT_OD);
+}
+
+void dhtTask(void *arg) {
+  // Set up here so the RMT interrupt is allocated on this task's core.
+  dhtBegin();
+  TickType_t wake = xTaskGetTickCount();
+  for (;;) {
+    // DHT11 spec ~1 Hz; this also covers its power-up settling time.
+    vTaskDelayUntil(&wake, pdMS_TO_TICKS(DHT_MIN_PERIOD_MS));
+    uint32_t start = micros();
+    DhtSample d;
+    if (dhtRead(&d.temp, &d.hum)) {
+      d.atMs = millis();
+      dhtLatest.store(d);
+      dhtToView.push(d);
+      oledKick();
+    } else {
+      dhtErrors++;
+    }
+    timingRecord(TIMING_DHT, start);
+  }
+}
+
+// Answers from the newest reading dhtTask has stored; age_ms is how old it is.
+void sendDhtJson() {
+  DhtSample d = {NAN, NAN, 0};
+  (void)dhtLatest.load(&d);
+  float t = d.temp, h = d.hum;
+  uint32_t at = d.atMs;
 
   // Reply regardless; if read failed, report an error JSON
-  if (!isnan(dhtTemp) && !isnan(dhtHum)) {
+  if (!isnan(t) && !isnan(h)) {
     // Keep it compact, one decimal place
     char line[64];
-    snprintf(line, sizeof(line), "{\"temp\":%.1f,\"humidity\":%.1f}\n", dhtTemp,
-             dhtHum);
-    Serial1.print(line);
-    Serial.print("Sent to MCXC: ");
-    Serial.print(line);
+    snprintf(line, sizeof(line), "{\"temp\":%.1f,\"humidity\":%.1f,\"age_ms\":%lu}\n",
+             t, h, (unsigned long)(millis() - at));
+    mcxcWrite(line);
+    protoLogf("Sent to MCXC: %s", line);
   } else {
-    Serial1.println("{\"error\":\"DHT fail\"}");
-    Serial.println("Sent to MCXC: {\"error\":\"DHT fail\"}");
+    mcxcWrite("{\"error\":\"DHT fail\"}\r\n");
+    protoLogf("Sent to MCXC: {\"error\":\"DHT fail\"}\n");
   }
 }
 
-bool tryParseMcxcJson(const String &s) {
+bool tryParseMcxcJson(const char *s) {
   // Expecting: {"photo":<int>,"water":<int>}
   StaticJsonDocument<128> doc;
   DeserializationError err = deserializeJson(doc, s);
   if (err)
     return false;
 
-  // Optional: tolerate either raw or missing fields (keep last if missing)
-  if (doc.containsKey("photo")) {
-    int v = doc["photo"];
-    if (v >= 0)
-      photoVal = v;
-  }
-  if (doc.containsKey("water")) {
-    int v = doc["water"];
-    if (v >= 0)
-      waterVal = v;
+  // Optional: tolerate either raw or missing fields (oledTask keeps the last)
+  McxcSample m = {-1, -1, -1, "", 0};
+  if (doc.containsKey("photo"))
+    m.photo = doc["photo"];
+  if (doc.containsKey("water"))
+    m.water = doc["water"];
+  // Periodic CPU stats frame: {"idle":92,"top":"Hub","load":5}
+  if (doc.containsKey("idle")) {
+    m.cpuIdle = doc["idle"];
+    strlcpy(m.cpuTop, doc["top"] | "", sizeof(m.cpuTop));
   }
-  lastMcxcUpdateMs = millis();
-  Serial.print("MCXC update: ");
-  Serial.println(s);
+  m.atMs = millis();
+  mcxcToView.push(m);
+  oledKick();
+  protoLogf("MCXC update: %s\n", s);
   return true;
 }
 
-void handleUartLine(const String &line) {
-  String s = line;
-  s.trim();
-  if (s.length() == 0)
+// s is NUL-terminated and already trimmed.
+void handleUartLine(const char *s) {
+  if (*s == '\0')
     return; // ignore empty
 
   // Command path
-  if (s.equalsIgnoreCase("GET_DHT")) {
+  if (strcasecmp(s, "GET_DHT") == 0) {
     sendDhtJson();
     return;
   }
 
   // JSON path (MCXC sensor update)
-  if (s.startsWith("{")) {
-    if (!tryParseMcxcJson(s)) {
-      Serial.print("Invalid JSON from MCXC: ");
-      Serial.println(s);
-    }
+  if (s[0] == '{') {
+    if (!tryParseMcxcJson(s))
+      protoLogf("Invalid JSON from MCXC: %s\n", s);
+    return;
+  }
+
+  // Replies to forwarded rule / STATS commands
+  if (strncmp(s, "OK ", 3) == 0 || strncmp(s, "ERR ", 4) == 0 ||
+      strncmp(s, "STAT ", 5) == 0) {
+    protoLogf("MCXC: %s\n", s);
     return;
   }
 
   // Unknown input (filter UART noise)
-  Serial.print("Unknown input: ");
-  Serial.println(s);
+  protoLogf("Unknown input: %s\n", s);
+}
+
+void mcxcUartBegin() {
+  uart_config_t cfg = {};
+  cfg.baud_rate = MCXC_BAUD;
+  cfg.data_bits = UART_DATA_8_BITS;
+  cfg.parity = UART_PARITY_DISABLE;
+  cfg.stop_bits = UART_STOP_BITS_1;
+  cfg.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+  cfg.source_clk = UART_SCLK_APB;
+  uart_driver_install(MCXC_UART, MCXC_RX_BUF, MCXC_TX_BUF, MCXC_EVENT_QUEUE,
+                      &mcxcUartEvents, 0);
+  uart_param_config(MCXC_UART, &cfg);
+  uart_set_pin(MCXC_UART, UART_TX_PIN, UART_RX_PIN, UART_PIN_NO_CHANGE,
+               UART_PIN_NO_CHANGE);
+  // One '\n' ends a line; no idle time is required around it.
+  uart_enable_pattern_det_baud_intr(MCXC_UART, '\n', 1, 1, 0, 0);
+  uart_pattern_queue_reset(MCXC_UART, MCXC_EVENT_QUEUE);
+}
+
+// Reads the next pattern-terminated line out of the driver's ring buffer into
+// line (trimmed, NUL-terminated). pos is the offset of its '\n' as reported by
+// uart_pattern_pop_pos(). Returns false for lines that do not fit; those are
+// read out and dropped.
+bool readMcxcLine(int pos, char *line, size_t size) {
+  uint8_t nl;
+  if ((size_t)pos >= size) {
+    while (pos > 0) {
+      int got = uart_read_bytes(MCXC_UART, (uint8_t *)line,
+                                pos < (int)size ? pos : (int)size, pdMS_TO_TICKS(20));
+      if (got <= 0)
+        break;
+      pos -= got;
+    }
+    uart_read_bytes(MCXC_UART, &nl, 1, pdMS_TO_TICKS(20));
+    return false;
+  }
+
+  int n = 0;
+  if (pos > 0)
+    n = uart_read_bytes(MCXC_UART, (uint8_t *)line, pos, pdMS_TO_TICKS(20));
+  uart_read_bytes(MCXC_UART, &nl, 1, pdMS_TO_TICKS(20));
+  if (n != pos)
+    return false;
+
+  while (n > 0 && isspace((unsigned char)line[n - 1]))
+    n--;
+  line[n] = '\0';
+  int start = 0;
+  while (isspace((unsigned char)line[start]))
+    start++;
+  if (start > 0)
+    memmove(line, line + start, n - start + 1);
+  return true;
+}
+
+// Serves the MCXC link. The driver raises UART_PATTERN_DET once a '\n' is in
+// its ring buffer, so this task only runs when a whole line is waiting, no
+// matter what the other core is doing.
+void mcxcUartTask(void *arg) {
+  static char line[MCXC_LINE_MAX + 1];
+  uart_event_t ev;
+
+  // Installed here so the UART interrupt is allocated on this task's core.
+  mcxcUartBegin();
+  // Optional: announce readiness to MCXC (harmless if ignored)
+  mcxcWrite("READY\r\n");
+
+  for (;;) {
+    if (xQueueReceive(mcxcUartEvents, &ev, portMAX_DELAY) != pdTRUE)
+      continue;
+    uint32_t start = micros();
+    switch (ev.type) {
+    case UART_PATTERN_DET: {
+      int pos = uart_pattern_pop_pos(MCXC_UART);
+      if (pos < 0) {
+        // Pattern position queue overflowed: line boundaries are lost.
+        uart_flush_input(MCXC_UART);
+        mcxcDropped++;
+        break;
+      }
+      if (readMcxcLine(pos, line, sizeof(line))) {
+        mcxcLines++;
+        handleUartLine(line);
+      } else {
+        mcxcDropped++;
+      }
+      break;
+    }
+    case UART_FIFO_OVF:
+    case UART_BUFFER_FULL:
+      // Resync on the next '\n'; queued events refer to flushed data.
+      uart_flush_input(MCXC_UART);
+      xQueueReset(mcxcUartEvents);
+      mcxcDropped++;
+      protoLogf("MCXC UART overflow, input flushed\n");
+      break;
+    default:
+      break;
+    }
+    timingRecord(TIMING_UART, start);
+  }
+}
+
+// Rules-engine commands (TH/HYST/PRED/RULE/RULES), STATS, TRACE and LOG typed
+// on USB go to the MCXC, so thresholds and the decision table can be changed
+// without reflashing, per-task CPU usage can be queried, a kernel trace
+// dumped (on the MCXC's own debug console) and its log levels changed.
+bool isRulesCommand(const String &s) {
+  int sp = s.indexOf(' ');
+  String verb = (sp < 0) ? s : s.substring(0, sp);
+  return verb.equalsIgnoreCase("TH") || verb.equalsIgnoreCase("HYST") ||
+         verb.equalsIgnoreCase("PRED") ||
+         verb.equalsIgnoreCase("RULE") || verb.equalsIgnoreCase("RULES") ||
+         verb.equalsIgnoreCase("STATS") || verb.equalsIgnoreCase("TRACE") ||
+         verb.equalsIgnoreCase("LOG");
+}
+
+// TASKS: per-task timing on the USB console.
+void printTaskStats() {
+  Serial.println("task       core     runs  avg_us  max_us  stack_free");
+  for (int i = 0; i < TIMING_COUNT; ++i) {
+    const TaskTiming &t = taskTiming[i];
+    uint32_t avg = t.runs ? (uint32_t)(t.totalUs / t.runs) : 0;
+    Serial.printf("%-10s %4d %8lu %7lu %7lu %11u\n", t.name, t.core,
+                  (unsigned long)t.runs, (unsigned long)avg,
+                  (unsigned long)t.maxUs,
+                  t.handle ? (unsigned)uxTaskGetStackHighWaterMark(t.handle) : 0u);
+  }
+  Serial.printf("drops: dht->view %lu mcxc->view %lu log %lu\n",
+                (unsigned long)dhtToView.drops,
+                (unsigned long)mcxcToView.drops, (unsigned long)protoLog.drops);
+  Serial.printf("mcxc lines %lu dropped %lu, dht errors %lu, oled flushes %lu "
+                "bytes %lu\n",
+                (unsigned long)mcxcLines, (unsigned long)mcxcDropped,
+                (unsigned long)dhtErrors, (unsigned long)oledFlushes,
+                (unsigned long)oledBytes);
+}
+
+void handleUsbLine(const String &line) {
+  String s = line;
+  s.trim();
+  if (s.length() == 0)
+    return;
+  if (s.equalsIgnoreCase("TASKS")) {
+    printTaskStats();
+    return;
+  }
+  if (isRulesCommand(s)) {
+    if (s.length() > MCXC_LINE_MAX) {
+      Serial.println("Command too long");
+      return;
+    }
+    // The MCXC may be in VLPS: the first byte only wakes it (and may arrive
+    // garbled), so a throwaway newline leads the command. One write per
+    // frame, so a DHT reply from the UART task cannot land in the middle;
+    // the MCXC is awake long before the second byte (~1 ms at 9600 baud).
+    char frame[MCXC_LINE_MAX + 5]; // "\n\n" + command + "\r\n"
+    snprintf(frame, sizeof(frame), "\n\n%s\r\n", s.c_str());
+    mcxcWrite(frame);
+    Serial.print("Sent to MCXC: ");
+    Serial.println(s);
+  } else {
+    Serial.print("Unknown command: ");
+    Serial.println(s);
+  }
 }
 
 // ================== Setup / Loop ==================
@@ -177,11 +723,9 @@ void setup() {
   delay(300);
   Serial.println("ESP32 Bridge + OLED + DHT starting...");
 
-  // UART to MCXC
-  Serial1.begin(9600, SERIAL_8N1, UART_RX_PIN, UART_TX_PIN);
-  delay(50);
-  // Optional: announce readiness to MCXC (harmless if ignored)
-  Serial1.println("READY");
+  // UART to MCXC, served by its own task on the protocol core
+  xTaskCreatePinnedToCore(mcxcUartTask, "mcxc_uart", 4096, NULL, 5,
+                          &taskTiming[TIMING_UART].handle, PROTO_CORE);
 
   // I2C + OLED
   Wire.begin(I2C_SDA, I2C_SCL);
@@ -199,11 +743,18 @@ void setup() {
   display.display();
   delay(600);
 
-  // DHT
-  dht.begin();
+  // DHT, sampled in the background
+  xTaskCreatePinnedToCore(dhtTask, "dht", 3072, NULL, 3,
+                          &taskTiming[TIMING_DHT].handle, APP_CORE);
 
-  // First draw
-  drawOLED();
+  // Start from a blank panel; oledTask sends only what differs from it.
+  display.clearDisplay();
+  display.display();
+  memset(oledPanel, 0, sizeof(oledPanel));
+  xTaskCreatePinnedToCore(oledTask, "oled", 4096, NULL, 2, &oledTaskHandle,
+                          APP_CORE);
+  taskTiming[TIMING_OLED].handle = oledTaskHandle;
+  taskTiming[TIMING_USB].handle = xTaskGetCurrentTaskHandle();
 }
 
 void loop() {
@@ -215,38 +766,34 @@ void loop() {
     Serial.print('.');
   }
 
-  // Non-blocking UART line reader
-  while (Serial1.available()) {
-    char c = (char)Serial1.read();
+  uint32_t start = micros();
+
+  // Operator commands from the USB console
+  while (Serial.available()) {
+    char c = (char)Serial.read();
     if (c == '\r')
-      continue; // normalize
+      continue;
     if (c == '\n') {
-      handleUartLine(uartLine);
-      uartLine = "";
-    } else {
-      // Avoid runaway if MCXC somehow spams without newline
-      if (uartLine.length() < 200)
-        uartLine += c;
-      else
-        uartLine = ""; // reset if absurdly long without newline
+      handleUsbLine(usbLine);
+      usbLine = "";
+    } else if (usbLine.length() < 100) {
+      usbLine += c;
     }
   }
 
-  // Opportunistic DHT refresh (for OLED freshness even without GET_DHT)
-  if (millis() - lastDhtReadMs >= DHT_MIN_PERIOD_MS) {
-    float t = dht.readTemperature();
-    float h = dht.readHumidity();
-    if (!isnan(t) && !isnan(h)) {
-      dhtTemp = t;
-      dhtHum = h;
-      lastDhtReadMs = millis();
+  // Debug output queued by the UART task
+  char out[64];
+  size_t n = 0;
+  while (protoLog.pop(&out[n])) {
+    if (++n == sizeof(out)) {
+      Serial.write((const uint8_t *)out, n);
+      n = 0;
     }
   }
+  if (n > 0)
+    Serial.write((const uint8_t *)out, n);
+  timingRecord(TIMING_USB, start);
 
-  // Update OLED at ~10 Hz max to avoid flicker
-  static uint32_t lastDraw = 0;
-  if (millis() - lastDraw >= 100) {
-    lastDraw = millis();
-    drawOLED();
-  }
+  // The display, sensor and MCXC link run in their own tasks.
+  delay(10);
 }
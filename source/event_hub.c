@@ -0,0 +1,157 @@
+/*
+ * @file    event_hub.c
+ * @brief   Queue-set dispatcher for UART lines, timer expiries and signal events
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+
+#include "event_hub.h"
+#include "rtos_objects.h"
+#include "runtime_clock.h"
+#include "sensor.h"
+#include "stack_monitor.h"
+#include "uart_bridge.h"
+
+typedef struct {
+    HubHandler_t handler;
+    uint32_t deadlineMs;
+} HubEntry_t;
+
+static const HubEntry_t kEntries[HUB_EVENT_COUNT] = {
+#define HUB_EVENT_ENTRY(id, handler, deadline) [HUB_EVENT_##id] = { (handler), (deadline) },
+    HUB_EVENT_TABLE(HUB_EVENT_ENTRY)
+#undef HUB_EVENT_ENTRY
+};
+
+static const char *const kNames[HUB_EVENT_COUNT] = {
+#define HUB_EVENT_NAME(id, handler, deadline) [HUB_EVENT_##id] = #id,
+    HUB_EVENT_TABLE(HUB_EVENT_NAME)
+#undef HUB_EVENT_NAME
+};
+
+_Static_assert(HUB_EVENT_COUNT <= 32u, "pending mask is 32 bits");
+
+static QueueSetHandle_t set;
+static SemaphoreHandle_t doorbell;
+static QueueHandle_t uartRx;
+
+static uint32_t pending;                       // bit per HubEvent_t
+static uint64_t postedAt[HUB_EVENT_COUNT];     // first post of the pending event
+static HubStat_t stats[HUB_EVENT_COUNT];
+
+void EventHub_Init(void) {
+    set = RTOS_QUEUE_SET(Hub);
+    doorbell = RTOS_SEMAPHORE(HubDoorbell);
+    uartRx = RTOS_QUEUE(UartRx);
+    configASSERT(set != NULL && doorbell != NULL && uartRx != NULL);
+
+    // Members must be empty when added: nothing has run yet.
+    BaseType_t ok = xQueueAddToSet(uartRx, set);
+    configASSERT(ok == pdPASS);
+    ok = xQueueAddToSet(doorbell, set);
+    configASSERT(ok == pdPASS);
+
+    for (uint32_t i = 0; i < HUB_EVENT_COUNT; ++i) {
+        stats[i].name = kNames[i];
+    }
+}
+
+void EventHub_Post(HubEvent_t event) {
+    configASSERT(event < HUB_EVENT_COUNT);
+    uint64_t now = RuntimeClock_Cycles();
+    bool ring;
+
+    taskENTER_CRITICAL();
+    uint32_t bit = 1u << event;
+    if (pending & bit) {
+        stats[event].coalesced++;
+    } else {
+        postedAt[event] = now;
+    }
+    ring = (pending == 0u);
+    pending |= bit;
+    taskEXIT_CRITICAL();
+
+    // One doorbell per batch; the dispatcher drains the whole mask.
+    if (ring) {
+        (void)xSemaphoreGive(doorbell);
+    }
+}
+
+void EventHub_TimerCallback(TimerHandle_t timer) {
+    EventHub_Post((HubEvent_t)(uintptr_t)pvTimerGetTimerID(timer));
+}
+
+static void dispatch(HubEvent_t event, const void *payload, uint64_t postCycles) {
+    uint64_t start = RuntimeClock_Cycles();
+    kEntries[event].handler(event, payload);
+    uint64_t end = RuntimeClock_Cycles();
+
+    uint32_t handlerUs = RuntimeClock_CyclesToUs(end - start);
+    uint32_t latencyUs = RuntimeClock_CyclesToUs(end - postCycles);
+    HubStat_t *st = &stats[event];
+    taskENTER_CRITICAL();
+    st->calls++;
+    if (handlerUs > st->handlerMaxUs) {
+        st->handlerMaxUs = handlerUs;
+    }
+    if (latencyUs > st->latencyMaxUs) {
+        st->latencyMaxUs = latencyUs;
+    }
+    if (kEntries[event].deadlineMs != 0u && latencyUs > kEntries[event].deadlineMs * 1000u) {
+        st->late++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+static void drain_signals(void) {
+    uint32_t mask;
+    uint64_t stamps[HUB_EVENT_COUNT];
+
+    (void)xSemaphoreTake(doorbell, 0);
+    taskENTER_CRITICAL();
+    mask = pending;
+    pending = 0u;
+    memcpy(stamps, postedAt, sizeof(stamps));
+    taskEXIT_CRITICAL();
+
+    for (uint32_t i = 0; i < HUB_EVENT_COUNT; ++i) {
+        if (mask & (1u << i)) {
+            dispatch((HubEvent_t)i, NULL, stamps[i]);
+        }
+    }
+}
+
+void EventHub_Task(void *pvParameters) {
+    (void)pvParameters;
+    static char line[UART_BRIDGE_MAX_MSG_LEN];   // one receive buffer, off the stack
+
+    for (;;) {
+        QueueSetMemberHandle_t member = xQueueSelectFromSet(set, portMAX_DELAY);
+        if (member == (QueueSetMemberHandle_t)uartRx) {
+            // Lines carry no post time; latency is counted from here.
+            if (xQueueReceive(uartRx, line, 0) == pdTRUE) {
+                dispatch(HUB_EVENT_UART_FRAME, line, RuntimeClock_Cycles());
+            }
+        } else if (member == (QueueSetMemberHandle_t)doorbell) {
+            drain_signals();
+        }
+    }
+}
+
+uint8_t EventHub_GetStats(HubStat_t *out, uint8_t max) {
+    uint8_t n = 0;
+    taskENTER_CRITICAL();
+    for (; n < HUB_EVENT_COUNT && n < max; ++n) {
+        out[n] = stats[n];
+    }
+    taskEXIT_CRITICAL();
+    return n;
+}
@@ -0,0 +1,66 @@
+#ifndef EVENT_HUB_H_
+#define EVENT_HUB_H_
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "timers.h"
+
+// One dispatcher task ("Hub") for the application's event-driven work.
+// It replaces the separate Actuator, UART-RX, UART-TX and StackMon tasks,
+// which only blocked on a queue or a delay and then ran a short handler.
+// It blocks on a queue set with two members:
+//   - the UART2 receive queue. The RX interrupt's lines are handled
+//     straight from it, with no forwarding task.
+//   - a doorbell semaphore for signal events. EventHub_Post sets the
+//     event's pending bit and rings the doorbell, so repeated posts of one
+//     event before it is handled coalesce into one call.
+// Periodic events come from the software timers in RTOS_TIMER_TABLE.
+//
+// Handlers run in table order within one wake-up and must not block for
+// long: every other event waits behind them. Per event the hub counts
+// calls, coalesced posts, the worst post -> handler-done latency and
+// deadline misses ("STAT hub ..." in the STATS report).
+
+// X(id, handler, deadlineMs) -- deadline 0: not checked
+#define HUB_EVENT_TABLE(X)                                       \
+    X(SENSOR,       UART_Bridge_OnSensorUpdate,   100u)         \
+    X(UART_FRAME,   UART_Bridge_OnFrame,          0u)           \
+    X(DHT_POLL,     UART_Bridge_OnPollTimer,      200u)         \
+    X(PLANT_LOGIC,  Actuator_OnLogicTimer,        1000u)        \
+    X(STACK_REPORT, StackMonitor_OnTimer,         0u)
+
+typedef enum {
+#define HUB_EVENT_ENUM(id, handler, deadline) HUB_EVENT_##id,
+    HUB_EVENT_TABLE(HUB_EVENT_ENUM)
+#undef HUB_EVENT_ENUM
+    HUB_EVENT_COUNT
+} HubEvent_t;
+
+// payload: the received line for UART_FRAME, NULL for signal events.
+typedef void (*HubHandler_t)(HubEvent_t event, const void *payload);
+
+typedef struct {
+    const char *name;
+    uint32_t calls;
+    uint32_t coalesced;      // posts merged into an already pending one
+    uint32_t late;           // latency above the deadline
+    uint32_t latencyMaxUs;   // post -> handler done
+    uint32_t handlerMaxUs;   // handler alone
+} HubStat_t;
+
+// Adds the UART receive queue and the doorbell to the queue set; call
+// after UART_Bridge_Init and before the scheduler starts.
+void EventHub_Init(void);
+
+// Signal events, from tasks and timer callbacks (never blocks).
+void EventHub_Post(HubEvent_t event);
+// Callback of every timer in RTOS_TIMER_TABLE; the timer ID is the event.
+void EventHub_TimerCallback(TimerHandle_t timer);
+
+void EventHub_Task(void *pvParameters);
+
+// Copies up to max entries (table order); returns the number copied.
+uint8_t EventHub_GetStats(HubStat_t *out, uint8_t max);
+
+#endif /* EVENT_HUB_H_ */
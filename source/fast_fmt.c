@@ -0,0 +1,107 @@
+/*
+ * @file    fast_fmt.c
+ * @brief   Straight-line integer/string formatting into a buffer
+ */
+
+#include <string.h>
+
+#include "fast_fmt.h"
+
+static const uint32_t kPow10[] = {
+    1000000000u, 100000000u, 10000000u, 1000000u, 100000u, 10000u, 1000u, 100u, 10u, 1u,
+};
+#define POW10_COUNT  (sizeof(kPow10) / sizeof(kPow10[0]))
+
+void FastFmt_Put(FastFmt_t *f, const char *s, size_t len) {
+    size_t room = (size_t)(f->end - f->p);
+    if (len > room) {
+        len = room;
+        f->overflow = true;
+    }
+    memcpy(f->p, s, len);
+    f->p += len;
+}
+
+void FastFmt_Str(FastFmt_t *f, const char *s) {
+    while (*s != '\0') {
+        if (f->p == f->end) {
+            f->overflow = true;
+            return;
+        }
+        *f->p++ = *s++;
+    }
+}
+
+void FastFmt_Char(FastFmt_t *f, char c) {
+    if (f->p == f->end) {
+        f->overflow = true;
+        return;
+    }
+    *f->p++ = c;
+}
+
+// Digits of v into out (most significant first); returns the count.
+static uint32_t u32_digits(uint32_t v, char out[POW10_COUNT]) {
+    uint32_t i = 0;
+    while (i < POW10_COUNT - 1u && v < kPow10[i]) {
+        i++;
+    }
+    uint32_t n = 0;
+    for (; i < POW10_COUNT; ++i) {
+        char d = '0';
+        while (v >= kPow10[i]) {
+            v -= kPow10[i];
+            d++;
+        }
+        out[n++] = d;
+    }
+    return n;
+}
+
+void FastFmt_U32(FastFmt_t *f, uint32_t v) {
+    char digits[POW10_COUNT];
+    FastFmt_Put(f, digits, u32_digits(v, digits));
+}
+
+void FastFmt_U32Pad(FastFmt_t *f, uint32_t v, uint8_t width) {
+    char digits[POW10_COUNT];
+    uint32_t n = u32_digits(v, digits);
+    while (width > n) {
+        FastFmt_Char(f, ' ');
+        width--;
+    }
+    FastFmt_Put(f, digits, n);
+}
+
+void FastFmt_I32(FastFmt_t *f, int32_t v) {
+    if (v < 0) {
+        FastFmt_Char(f, '-');
+        FastFmt_U32(f, 0u - (uint32_t)v);
+    } else {
+        FastFmt_U32(f, (uint32_t)v);
+    }
+}
+
+void FastFmt_Hex(FastFmt_t *f, uint32_t v, uint8_t digits) {
+    static const char kHex[] = "0123456789abcdef";
+    char out[8];
+    uint32_t n = 8u;
+    if (digits == 0u) {
+        digits = 1u;
+        while (digits < 8u && (v >> (4u * digits)) != 0u) {
+            digits++;
+        }
+    } else if (digits > 8u) {
+        digits = 8u;
+    }
+    for (uint32_t i = 0; i < digits; ++i) {
+        out[--n] = kHex[v & 0x0Fu];
+        v >>= 4;
+    }
+    FastFmt_Put(f, &out[n], digits);
+}
+
+int FastFmt_End(FastFmt_t *f, const char *buf) {
+    *f->p = '\0';
+    return f->overflow ? -1 : (int)(f->p - buf);
+}
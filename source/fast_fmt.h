@@ -0,0 +1,57 @@
+#ifndef FAST_FMT_H_
+#define FAST_FMT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Formatter for the hot paths that only print unsigned/signed integers, hex
+// and short strings. The format is spelled out at the call site as a
+// sequence of pieces, so nothing is parsed at run time:
+//
+//     char line[32];
+//     int n = FAST_FMT(line, sizeof(line),
+//                      FMT_LIT("water_adc: ") FMT_U(water) FMT_LIT(", light_adc: ")
+//                      FMT_U(light) FMT_LIT("\r\n"));
+//
+// Each piece expands to one direct call that appends to the buffer: no
+// format interpreter and no per-character callback. Arguments are checked
+// against the typed functions below, so FMT_U on a pointer warns. Digits
+// come from repeated subtraction of powers of ten, because the Cortex-M0+
+// has no divide instruction.
+// FAST_FMT NUL-terminates the buffer. It returns the length, or -1 if the
+// text did not fit (the buffer then holds as much as fitted), like the
+// snprintf checks it replaces.
+// RTOS_BENCH measures it against StrFormatPrintf (rtos_bench.h).
+
+typedef struct {
+    char *p;
+    char *end;          // last byte, kept for the NUL
+    bool overflow;
+} FastFmt_t;
+
+void FastFmt_Put(FastFmt_t *f, const char *s, size_t len);
+void FastFmt_Str(FastFmt_t *f, const char *s);
+void FastFmt_Char(FastFmt_t *f, char c);
+void FastFmt_U32(FastFmt_t *f, uint32_t v);
+void FastFmt_U32Pad(FastFmt_t *f, uint32_t v, uint8_t width);   // %<width>u
+void FastFmt_I32(FastFmt_t *f, int32_t v);
+void FastFmt_Hex(FastFmt_t *f, uint32_t v, uint8_t digits);     // low <digits> hex digits; 0: all
+int FastFmt_End(FastFmt_t *f, const char *buf);
+
+#define FAST_FMT(buf, size, pieces)                                              \
+    ({                                                                           \
+        FastFmt_t fastFmt_ = { (buf), (buf) + (size) - 1u, false };              \
+        pieces                                                                   \
+        FastFmt_End(&fastFmt_, (buf));                                           \
+    })
+
+#define FMT_LIT(s)        FastFmt_Put(&fastFmt_, "" s, sizeof(s) - 1u);
+#define FMT_S(s)          FastFmt_Str(&fastFmt_, (s));
+#define FMT_C(c)          FastFmt_Char(&fastFmt_, (c));
+#define FMT_U(v)          FastFmt_U32(&fastFmt_, (v));
+#define FMT_UW(v, width)  FastFmt_U32Pad(&fastFmt_, (v), (width));
+#define FMT_D(v)          FastFmt_I32(&fastFmt_, (v));
+#define FMT_X(v, digits)  FastFmt_Hex(&fastFmt_, (v), (digits));
+
+#endif /* FAST_FMT_H_ */
@@ -0,0 +1,93 @@
+/*
+ * @file    log.c
+ * @brief   Runtime per-module log levels and the LOG command
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "cmd_token.h"
+#include "log.h"
+
+volatile uint8_t gLogModuleLevel[LOG_MODULE_COUNT] = {
+#define LOG_MODULE_INIT(id, tag) [LOG_MODULE_##id] = LOG_BUILD_LEVEL,
+    LOG_MODULE_TABLE(LOG_MODULE_INIT)
+#undef LOG_MODULE_INIT
+};
+
+static const char *const kModuleTags[LOG_MODULE_COUNT] = {
+#define LOG_MODULE_TAG(id, tag) [LOG_MODULE_##id] = tag,
+    LOG_MODULE_TABLE(LOG_MODULE_TAG)
+#undef LOG_MODULE_TAG
+};
+
+// Indexed by level; the first letter is the short form and the list tag.
+static const char *const kLevelNames[] = { "off", "error", "warn", "info", "debug", "trace" };
+#define LEVEL_COUNT  (sizeof(kLevelNames) / sizeof(kLevelNames[0]))
+
+static int parse_level(const char *tok) {
+    for (int i = 0; i < (int)LEVEL_COUNT; ++i) {
+        if (CmdToken_Equals(tok, kLevelNames[i]) ||
+            (tok[1] == '\0' && tolower((unsigned char)tok[0]) == kLevelNames[i][0])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void list_levels(char *reply, size_t replyLen) {
+    size_t n = (size_t)snprintf(reply, replyLen, "OK LOG");
+    for (int i = 0; i < LOG_MODULE_COUNT && n < replyLen; ++i) {
+        n += (size_t)snprintf(reply + n, replyLen - n, " %s=%c", kModuleTags[i],
+                              toupper((unsigned char)kLevelNames[gLogModuleLevel[i]][0]));
+    }
+    if (n < replyLen) {
+        snprintf(reply + n, replyLen - n, " build=%c\n",
+                 toupper((unsigned char)kLevelNames[LOG_BUILD_LEVEL][0]));
+    }
+}
+
+bool Log_HandleCommand(const char *line, char *reply, size_t replyLen) {
+    char verb[8];
+    char module[12];
+    char level[8];
+    const char *args = line;
+
+    if (line == NULL || !CmdToken_Next(&args, verb, sizeof(verb)) || !CmdToken_Equals(verb, "LOG")) {
+        return false;
+    }
+    if (CmdToken_AtEnd(args)) {
+        if (reply && replyLen) {
+            list_levels(reply, replyLen);
+        }
+        return true;
+    }
+
+    int lvl = (CmdToken_Next(&args, module, sizeof(module)) && CmdToken_Next(&args, level, sizeof(level)))
+                  ? parse_level(level) : -1;
+    bool all = CmdToken_Equals(module, "all");
+    bool ok = false;
+    if (lvl >= 0) {
+        // Levels that were compiled out cannot be turned back on.
+        if (lvl > LOG_BUILD_LEVEL) {
+            lvl = LOG_BUILD_LEVEL;
+        }
+        for (int i = 0; i < LOG_MODULE_COUNT; ++i) {
+            if (all || CmdToken_Equals(module, kModuleTags[i])) {
+                gLogModuleLevel[i] = (uint8_t)lvl;
+                ok = true;
+            }
+        }
+    }
+
+    if (reply && replyLen) {
+        if (ok) {
+            list_levels(reply, replyLen);
+        } else {
+            snprintf(reply, replyLen, "ERR LOG\n");
+        }
+    }
+    return true;
+}
@@ -0,0 +1,92 @@
+#ifndef LOG_H_
+#define LOG_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "log_token.h"
+
+// Leveled, per-module logging front end:
+//     LOG_WARN(DEADLINE, "miss %u us\r\n", us);
+// prints "W/DEADLINE miss 1234 us" through LOG_TOKEN (log_token.h).
+//
+// Levels above LOG_BUILD_LEVEL expand to nothing: no code, no format
+// string, and the arguments are not evaluated. Release builds (NDEBUG)
+// keep ERROR only; debug builds keep everything up to DEBUG.
+// The levels that are built in are also filtered at run time, per module,
+// by gLogModuleLevel. It starts at LOG_BUILD_LEVEL for every module and is
+// changed with the LOG command (Log_HandleCommand), from the ESP32's USB
+// serial:
+//     LOG                      list: OK LOG sensor=D bridge=D ... build=D
+//     LOG <module|all> <level> level: off, error, warn, info, debug, trace
+//                              (or the first letter)
+
+#define LOG_LEVEL_OFF     0
+#define LOG_LEVEL_ERROR   1
+#define LOG_LEVEL_WARN    2
+#define LOG_LEVEL_INFO    3
+#define LOG_LEVEL_DEBUG   4
+#define LOG_LEVEL_TRACE   5
+
+#ifndef LOG_BUILD_LEVEL
+#if defined(NDEBUG)
+#define LOG_BUILD_LEVEL   LOG_LEVEL_ERROR
+#else
+#define LOG_BUILD_LEVEL   LOG_LEVEL_DEBUG
+#endif
+#endif
+
+// X(id, tag) -- tag is the name the LOG command takes
+#define LOG_MODULE_TABLE(X)      \
+    X(SENSOR,    "sensor")       \
+    X(BRIDGE,    "bridge")       \
+    X(DEADLINE,  "deadline")
+
+typedef enum {
+#define LOG_MODULE_ENUM(id, tag) LOG_MODULE_##id,
+    LOG_MODULE_TABLE(LOG_MODULE_ENUM)
+#undef LOG_MODULE_ENUM
+    LOG_MODULE_COUNT
+} LogModule_t;
+
+extern volatile uint8_t gLogModuleLevel[LOG_MODULE_COUNT];
+
+#define LOG_AT(level, prefix, mod, fmt, ...)                                  \
+    do {                                                                      \
+        if (gLogModuleLevel[LOG_MODULE_##mod] >= (level)) {                   \
+            LOG_TOKEN(prefix #mod " " fmt, ##__VA_ARGS__);                    \
+        }                                                                     \
+    } while (0)
+
+#if (LOG_BUILD_LEVEL >= LOG_LEVEL_ERROR)
+#define LOG_ERROR(mod, fmt, ...)  LOG_AT(LOG_LEVEL_ERROR, "E/", mod, fmt, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(mod, fmt, ...)  ((void)0)
+#endif
+#if (LOG_BUILD_LEVEL >= LOG_LEVEL_WARN)
+#define LOG_WARN(mod, fmt, ...)   LOG_AT(LOG_LEVEL_WARN, "W/", mod, fmt, ##__VA_ARGS__)
+#else
+#define LOG_WARN(mod, fmt, ...)   ((void)0)
+#endif
+#if (LOG_BUILD_LEVEL >= LOG_LEVEL_INFO)
+#define LOG_INFO(mod, fmt, ...)   LOG_AT(LOG_LEVEL_INFO, "I/", mod, fmt, ##__VA_ARGS__)
+#else
+#define LOG_INFO(mod, fmt, ...)   ((void)0)
+#endif
+#if (LOG_BUILD_LEVEL >= LOG_LEVEL_DEBUG)
+#define LOG_DEBUG(mod, fmt, ...)  LOG_AT(LOG_LEVEL_DEBUG, "D/", mod, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(mod, fmt, ...)  ((void)0)
+#endif
+#if (LOG_BUILD_LEVEL >= LOG_LEVEL_TRACE)
+#define LOG_TRACE(mod, fmt, ...)  LOG_AT(LOG_LEVEL_TRACE, "T/", mod, fmt, ##__VA_ARGS__)
+#else
+#define LOG_TRACE(mod, fmt, ...)  ((void)0)
+#endif
+
+// Handles a LOG command line. Returns false if line is not one; otherwise
+// writes "OK LOG ..." or "ERR LOG\n" into reply.
+bool Log_HandleCommand(const char *line, char *reply, size_t replyLen);
+
+#endif /* LOG_H_ */
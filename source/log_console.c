@@ -0,0 +1,260 @@
+/*
+ * @file    log_console.c
+ * @brief   Per-task PRINTF rings drained to the serial manager by a low-priority task
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fsl_debug_console.h"
+#include "fsl_component_serial_manager.h"
+#include "fsl_str.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "log_console.h"
+
+#if (DEBUG_CONSOLE_ASYNC_LOG > 0U)
+
+#include "rtos_objects.h"
+
+#define DRAIN_CHUNK   64u
+
+typedef struct {
+    TaskHandle_t *owner;
+    uint8_t *data;
+    uint32_t mask;
+    volatile uint32_t head;    // bytes published (producer)
+    volatile uint32_t tail;    // bytes written out (consumer)
+    LogRingStat_t stat;
+} LogRing_t;
+
+// One message being formatted into a ring; passed to StrFormatPrintf as
+// its "buffer" so the callback writes straight into the ring.
+typedef struct {
+    LogRing_t *ring;
+    uint32_t len;              // bytes stored so far
+    uint32_t total;            // bytes the message would need
+    bool dropped;
+} LogWriter_t;
+
+#define LOG_RING_STORAGE(task, bytes) \
+    static uint8_t ucLogRing_##task[(bytes)]; \
+    _Static_assert(((bytes) & ((bytes) - 1u)) == 0u, #task " log ring size must be a power of two");
+LOG_CONSOLE_RING_TABLE(LOG_RING_STORAGE)
+
+static LogRing_t rings[] = {
+#define LOG_RING_INIT(task, bytes) \
+    { &RTOS_TASK(task), ucLogRing_##task, (bytes) - 1u, 0u, 0u, { .name = #task, .size = (bytes) } },
+    LOG_CONSOLE_RING_TABLE(LOG_RING_INIT)
+#undef LOG_RING_INIT
+};
+#define RING_COUNT  (sizeof(rings) / sizeof(rings[0]))
+
+static TaskHandle_t drainTask;
+static SERIAL_MANAGER_WRITE_HANDLE_DEFINE(writeHandle);
+static bool writeHandleOpen;
+
+static LogRing_t *ring_of_current_task(void) {
+    if (xPortIsInsideInterrupt() || xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+        return NULL;
+    }
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    for (uint32_t i = 0; i < RING_COUNT; ++i) {
+        if (*rings[i].owner == self) {
+            return &rings[i];
+        }
+    }
+    return NULL;
+}
+
+#if (LOG_CONSOLE_DROP_POLICY == LOG_CONSOLE_DROP_OLDEST)
+// Frees at least one byte by discarding the oldest published line (or all
+// published bytes if none ends in '\n'). Never touches the unpublished
+// message at head. Returns false if nothing could be freed.
+static bool drop_oldest(LogRing_t *r) {
+    bool freed = false;
+    taskENTER_CRITICAL();
+    uint32_t t = r->tail;
+    uint32_t h = r->head;
+    if (t != h) {
+        uint32_t n = t;
+        while (n != h && r->data[n & r->mask] != '\n') {
+            n++;
+        }
+        if (n != h) {
+            n++;   // past the '\n'
+        }
+        r->stat.droppedBytes += n - t;
+        r->stat.droppedMessages++;
+        r->tail = n;
+        freed = true;
+    }
+    taskEXIT_CRITICAL();
+    return freed;
+}
+#endif
+
+static void ring_put(char *buf, int32_t *indicator, char val, int len) {
+    LogWriter_t *w = (LogWriter_t *)buf;
+    LogRing_t *r = w->ring;
+    (void)indicator;
+
+    for (int i = 0; i < len; ++i) {
+        w->total++;
+        if (w->dropped) {
+            continue;
+        }
+        uint32_t pos = r->head + w->len;
+        if ((pos - r->tail) > r->mask) {
+#if (LOG_CONSOLE_DROP_POLICY == LOG_CONSOLE_DROP_OLDEST)
+            if (!drop_oldest(r)) {
+                w->dropped = true;   // longer than the whole ring
+                continue;
+            }
+#else
+            w->dropped = true;
+            continue;
+#endif
+        }
+        r->data[pos & r->mask] = (uint8_t)val;
+        w->len++;
+    }
+}
+
+int LogConsole_Printf(const char *fmt, ...) {
+    va_list ap;
+    int result;
+    LogRing_t *r = ring_of_current_task();
+
+    va_start(ap, fmt);
+    if (r == NULL) {
+        result = DbgConsole_Vprintf(fmt, ap);
+        va_end(ap);
+        return result;
+    }
+
+    LogWriter_t w = { r, 0u, 0u, false };
+    (void)StrFormatPrintf(fmt, ap, (char *)&w, ring_put);
+    va_end(ap);
+
+    if (w.dropped) {
+        taskENTER_CRITICAL();
+        r->stat.droppedMessages++;
+        r->stat.droppedBytes += w.total;
+        taskEXIT_CRITICAL();
+        return 0;
+    }
+
+    // Publish: the consumer only ever reads below head.
+    __asm volatile("" ::: "memory");
+    r->head += w.len;
+    uint32_t waiting = r->head - r->tail;
+    if (waiting > r->stat.highWater) {
+        r->stat.highWater = waiting;
+    }
+    r->stat.messages++;
+
+    if (drainTask != NULL) {
+        xTaskNotifyGive(drainTask);
+    }
+    return (int)w.len;
+}
+
+/* -------------------- DRAIN -------------------- */
+static void write_out(uint8_t *data, uint32_t len) {
+    if (!writeHandleOpen) {
+        if (g_serialHandle == NULL ||
+            SerialManager_OpenWriteHandle(g_serialHandle, (serial_write_handle_t)writeHandle) !=
+                kStatus_SerialManager_Success) {
+            return;
+        }
+        writeHandleOpen = true;
+    }
+    (void)SerialManager_WriteBlocking((serial_write_handle_t)writeHandle, data, len);
+}
+
+// Moves up to one chunk from r to the UART; returns the bytes written.
+static uint32_t drain_chunk(LogRing_t *r) {
+    uint8_t chunk[DRAIN_CHUNK];
+    uint32_t t = r->tail;
+    uint32_t n = r->head - t;
+    if (n == 0u) {
+        return 0u;
+    }
+    if (n > DRAIN_CHUNK) {
+        n = DRAIN_CHUNK;
+    }
+    uint32_t first = (r->mask + 1u) - (t & r->mask);   // bytes before the wrap
+    if (first > n) {
+        first = n;
+    }
+    memcpy(chunk, &r->data[t & r->mask], first);
+    memcpy(&chunk[first], r->data, n - first);
+
+#if (LOG_CONSOLE_DROP_POLICY == LOG_CONSOLE_DROP_OLDEST)
+    // The producer may have dropped these bytes while they were copied.
+    bool current;
+    taskENTER_CRITICAL();
+    current = (r->tail == t);
+    if (current) {
+        r->tail = t + n;
+    }
+    taskEXIT_CRITICAL();
+    if (!current) {
+        return 1u;   // retry from the new tail
+    }
+#else
+    r->tail = t + n;
+#endif
+    write_out(chunk, n);
+    return n;
+}
+
+void LogConsole_DrainTask(void *pvParameters) {
+    (void)pvParameters;
+    drainTask = xTaskGetCurrentTaskHandle();
+
+    for (;;) {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // Round-robin one chunk per ring so a burst does not starve the others.
+        uint32_t moved;
+        do {
+            moved = 0u;
+            for (uint32_t i = 0; i < RING_COUNT; ++i) {
+                moved += drain_chunk(&rings[i]);
+            }
+        } while (moved != 0u);
+    }
+}
+
+void LogConsole_Flush(void) {
+    for (uint32_t i = 0; i < RING_COUNT; ++i) {
+        while (drain_chunk(&rings[i]) != 0u) {
+        }
+    }
+}
+
+// fsl_assert.c prints the failed expression, calls this hook, then stops:
+// get the message (and anything before it) out first.
+int fsl_assert_hook(const char *failedExpr, const char *file, int line) {
+    (void)failedExpr;
+    (void)file;
+    (void)line;
+    LogConsole_Flush();
+    return 0;
+}
+
+uint8_t LogConsole_GetStats(LogRingStat_t *out, uint8_t max) {
+    uint8_t n = 0;
+    taskENTER_CRITICAL();
+    for (; n < RING_COUNT && n < max; ++n) {
+        out[n] = rings[n].stat;
+    }
+    taskEXIT_CRITICAL();
+    return n;
+}
+
+#endif /* DEBUG_CONSOLE_ASYNC_LOG */
@@ -0,0 +1,83 @@
+#ifndef LOG_CONSOLE_H_
+#define LOG_CONSOLE_H_
+
+#include <stdint.h>
+
+#include "fsl_debug_console.h"
+
+#include "FreeRTOS.h"
+
+#include "dht11.h"
+
+// Asynchronous debug console. With DEBUG_CONSOLE_ASYNC_LOG (on except in
+// the benchmark build, fsl_debug_console_conf.h), PRINTF is
+// LogConsole_Printf: it formats straight into a byte ring owned by the
+// calling task and returns at once.
+// The LogDrain task, the lowest application priority, writes the rings to
+// the serial manager. A task that logs never waits for the UART.
+//
+// Each ring has one producer (its task) and one consumer (LogDrain), so
+// with the drop-newest policy neither side locks. A message that does not
+// fit is dropped whole and its bytes are counted. With drop-oldest the
+// producer frees room by discarding the oldest whole lines instead. That
+// moves the consumer's index, so both sides take a short critical section.
+//
+// Tasks without a ring, ISRs and code before the scheduler starts print
+// synchronously, as before. The STATS report has one "STAT log ..." line
+// per ring.
+
+#define LOG_CONSOLE_DROP_NEWEST   0
+#define LOG_CONSOLE_DROP_OLDEST   1
+#ifndef LOG_CONSOLE_DROP_POLICY
+#define LOG_CONSOLE_DROP_POLICY   LOG_CONSOLE_DROP_NEWEST
+#endif
+
+// X(task, bytes) -- task: an RTOS_TASK_TABLE id; bytes: power of two,
+// sized for the task's largest burst. Hub's is a STACK report, written in
+// one handler without blocking. Stats blocks on UART2 (9600 baud) between
+// lines, so the drain keeps up and one line or two is enough. Dht11 logs
+// one short line per read, and exists only with the local sensor
+// (RTOS_DHT_TASKS).
+#if (DHT11_LOCAL_ENABLE > 0)
+#define LOG_CONSOLE_DHT_RINGS(X)    X(Dht11, 128u)
+#else
+#define LOG_CONSOLE_DHT_RINGS(X)
+#endif
+
+#define LOG_CONSOLE_RING_TABLE(X)   \
+    X(Sensor,  256u)                \
+    X(Hub,     512u)                \
+    X(Stats,   256u)                \
+    LOG_CONSOLE_DHT_RINGS(X)
+
+typedef struct {
+    const char *name;            // owning task
+    uint32_t size;
+    uint32_t messages;           // accepted
+    uint32_t droppedMessages;
+    uint32_t droppedBytes;
+    uint32_t highWater;          // most bytes waiting at once
+} LogRingStat_t;
+
+#if (DEBUG_CONSOLE_ASYNC_LOG > 0U)
+
+int LogConsole_Printf(const char *fmt, ...);
+
+// Drain task entry (RTOS_TASK_TABLE).
+void LogConsole_DrainTask(void *pvParameters);
+
+// Writes out everything still queued, from the calling context. For fault
+// paths, right before the core stops.
+void LogConsole_Flush(void);
+
+// Copies up to max entries (table order); returns the number copied.
+uint8_t LogConsole_GetStats(LogRingStat_t *out, uint8_t max);
+
+#else
+
+#define LogConsole_Flush()                ((void)0)
+#define LogConsole_GetStats(out, max)     ((void)(out), (uint8_t)0u)
+
+#endif /* DEBUG_CONSOLE_ASYNC_LOG */
+
+#endif /* LOG_CONSOLE_H_ */
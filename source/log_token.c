@@ -0,0 +1,113 @@
+/*
+ * @file    log_token.c
+ * @brief   Encodes tokenized log calls into base64 console lines
+ */
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "fsl_debug_console.h"
+
+#include "log_token.h"
+
+#if (LOG_TOKEN_ENABLE > 0)
+
+// Worst case for one field: a 64-bit varint
+#define FIELD_MAX   10u
+
+static uint8_t *put_varint(uint8_t *p, uint64_t v) {
+    while (v >= 0x80u) {
+        *p++ = (uint8_t)(v | 0x80u);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    return p;
+}
+
+static uint64_t zigzag(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+// '$', base64 of the payload, "\r\n", NUL
+static void emit(const uint8_t *data, uint32_t len) {
+    static const char kB64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    char line[1u + 4u * ((LOG_TOKEN_MAX_PAYLOAD + 2u) / 3u) + 3u];
+    char *p = line;
+
+    *p++ = '$';
+    for (uint32_t i = 0; i < len; i += 3u) {
+        uint32_t n = len - i;
+        uint32_t v = (uint32_t)data[i] << 16;
+        if (n > 1u) {
+            v |= (uint32_t)data[i + 1u] << 8;
+        }
+        if (n > 2u) {
+            v |= data[i + 2u];
+        }
+        *p++ = kB64[(v >> 18) & 0x3Fu];
+        *p++ = kB64[(v >> 12) & 0x3Fu];
+        *p++ = (n > 1u) ? kB64[(v >> 6) & 0x3Fu] : '=';
+        *p++ = (n > 2u) ? kB64[v & 0x3Fu] : '=';
+    }
+    *p++ = '\r';
+    *p++ = '\n';
+    *p = '\0';
+    PRINTF("%s", line);
+}
+
+void LogToken_Log(uint32_t id, uint32_t types, ...) {
+    uint8_t payload[LOG_TOKEN_MAX_PAYLOAD + FIELD_MAX];
+    uint8_t *p = put_varint(payload, id);
+    const uint8_t *end = &payload[LOG_TOKEN_MAX_PAYLOAD];
+    uint32_t count = types & 0x0Fu;
+    va_list ap;
+
+    va_start(ap, types);
+    // Fields that would overrun the payload are left off; the decoder
+    // shows them as missing.
+    for (uint32_t i = 0; i < count && i < LOG_TOKEN_MAX_ARGS; ++i) {
+        uint8_t *field = p;
+        if (p >= end) {
+            break;
+        }
+        switch ((types >> (4u + 2u * i)) & 3u) {
+        case LOG_TOKEN_ARG_INT:
+            p = put_varint(p, zigzag((int32_t)va_arg(ap, int)));
+            break;
+        case LOG_TOKEN_ARG_INT64:
+            p = put_varint(p, zigzag(va_arg(ap, long long)));
+            break;
+        case LOG_TOKEN_ARG_DOUBLE: {
+            double d = va_arg(ap, double);
+            memcpy(p, &d, sizeof(d));   // little-endian core
+            p += sizeof(d);
+            break;
+        }
+        default: {
+            const char *s = va_arg(ap, const char *);
+            uint32_t room = (uint32_t)(end - p) - 1u;
+            uint32_t max = (room < LOG_TOKEN_MAX_STRING) ? room : LOG_TOKEN_MAX_STRING;
+            uint32_t n = 0;
+            if (s == NULL) {
+                s = "(null)";
+            }
+            while (n < max && s[n] != '\0') {
+                n++;
+            }
+            *p++ = (uint8_t)(n | ((s[n] != '\0') ? 0x80u : 0u));
+            memcpy(p, s, n);
+            p += n;
+            break;
+        }
+        }
+        if (p > end) {
+            p = field;
+            break;
+        }
+    }
+    va_end(ap);
+
+    emit(payload, (uint32_t)(p - payload));
+}
+
+#endif /* LOG_TOKEN_ENABLE */
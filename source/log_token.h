@@ -0,0 +1,99 @@
+#ifndef LOG_TOKEN_H_
+#define LOG_TOKEN_H_
+
+#include <stdint.h>
+
+#include "fsl_debug_console.h"
+
+// Tokenized logging: LOG_TOKEN(fmt, ...) takes printf arguments like
+// PRINTF, but the device never formats them. The format string goes into
+// .logfmt, a section the linker keeps in GP.axf but never loads into
+// flash. Its offset in that section is the call site's ID. At run time only
+// the ID and the raw arguments are sent, as one console line:
+//     $<base64 payload>\r\n
+// The line goes through PRINTF, so it takes the task's log ring
+// (log_console.h) or the synchronous fallback like any other output.
+// tools/log_detokenize.py reads the strings back out of GP.axf and turns
+// the lines of a console capture back into text.
+//
+// Payload: varint ID, then one field per argument, chosen by its C type:
+//     integers up to 32 bits   zigzag varint
+//     64-bit integers          zigzag varint
+//     float/double             8 bytes, little-endian IEEE 754
+//     char pointers            length byte (bit 7: truncated), then bytes
+// Up to LOG_TOKEN_MAX_ARGS arguments. The compiler still checks them
+// against the format string.
+
+#ifndef LOG_TOKEN_ENABLE
+// The section trick uses ARM assembler syntax. The host simulation and the
+// benchmark build print plain text.
+#if defined(__arm__) && !defined(RTOS_BENCH)
+#define LOG_TOKEN_ENABLE   1
+#else
+#define LOG_TOKEN_ENABLE   0
+#endif
+#endif
+
+#define LOG_TOKEN_MAX_ARGS      8u
+#define LOG_TOKEN_MAX_PAYLOAD   64u     // bytes before base64; longer is cut
+#define LOG_TOKEN_MAX_STRING    48u     // bytes kept of a string argument
+
+// Argument type codes, 2 bits each in the types word
+#define LOG_TOKEN_ARG_INT       0u
+#define LOG_TOKEN_ARG_INT64     1u
+#define LOG_TOKEN_ARG_DOUBLE    2u
+#define LOG_TOKEN_ARG_STRING    3u
+
+#if (LOG_TOKEN_ENABLE > 0)
+
+// types: argument count in bits 0-3, argument i's type code at bit 4 + 2i.
+void LogToken_Log(uint32_t id, uint32_t types, ...);
+
+// Only reached by the compiler's format check; never defined.
+void LogToken_FormatCheck(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+// Non-loaded section: everything after '@' comments out the flags GCC
+// appends.
+#define LOG_TOKEN_SECTION   ".logfmt,\"\",%progbits @"
+
+#define LOG_TOKEN(fmt, ...)                                                           \
+    do {                                                                              \
+        static const char logTokenFmt_[] __attribute__((section(LOG_TOKEN_SECTION), used)) = fmt; \
+        if (0) {                                                                      \
+            LogToken_FormatCheck(fmt, ##__VA_ARGS__);                                 \
+        }                                                                             \
+        LogToken_Log((uint32_t)(uintptr_t)logTokenFmt_,                              \
+                     LOG_TOKEN_TYPES(__VA_ARGS__), ##__VA_ARGS__);                    \
+    } while (0)
+
+#define LOG_TOKEN_TYPE(x) _Generic((x),                                                \
+    char *: LOG_TOKEN_ARG_STRING, const char *: LOG_TOKEN_ARG_STRING,                 \
+    float: LOG_TOKEN_ARG_DOUBLE, double: LOG_TOKEN_ARG_DOUBLE,                        \
+    long long: LOG_TOKEN_ARG_INT64, unsigned long long: LOG_TOKEN_ARG_INT64,          \
+    default: LOG_TOKEN_ARG_INT)
+#define LOG_TOKEN_AT(i, x)   ((uint32_t)LOG_TOKEN_TYPE(x) << (4u + 2u * (i)))
+
+#define LOG_TOKEN_NARGS(...)  LOG_TOKEN_NARGS_(0, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_TOKEN_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...)  n
+#define LOG_TOKEN_CAT(a, b)   LOG_TOKEN_CAT_(a, b)
+#define LOG_TOKEN_CAT_(a, b)  a##b
+#define LOG_TOKEN_TYPES(...) \
+    LOG_TOKEN_CAT(LOG_TOKEN_TYPES_, LOG_TOKEN_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define LOG_TOKEN_TYPES_0()                      0u
+#define LOG_TOKEN_TYPES_1(a)                     (1u | LOG_TOKEN_AT(0, a))
+#define LOG_TOKEN_TYPES_2(a, b)                  (2u | LOG_TOKEN_AT(0, a) | LOG_TOKEN_AT(1, b))
+#define LOG_TOKEN_TYPES_3(a, b, c)               (3u | LOG_TOKEN_AT(0, a) | LOG_TOKEN_AT(1, b) | LOG_TOKEN_AT(2, c))
+#define LOG_TOKEN_TYPES_4(a, b, c, d)            ((LOG_TOKEN_TYPES_3(a, b, c) + 1u) | LOG_TOKEN_AT(3, d))
+#define LOG_TOKEN_TYPES_5(a, b, c, d, e)         ((LOG_TOKEN_TYPES_4(a, b, c, d) + 1u) | LOG_TOKEN_AT(4, e))
+#define LOG_TOKEN_TYPES_6(a, b, c, d, e, f)      ((LOG_TOKEN_TYPES_5(a, b, c, d, e) + 1u) | LOG_TOKEN_AT(5, f))
+#define LOG_TOKEN_TYPES_7(a, b, c, d, e, f, g)   ((LOG_TOKEN_TYPES_6(a, b, c, d, e, f) + 1u) | LOG_TOKEN_AT(6, g))
+#define LOG_TOKEN_TYPES_8(a, b, c, d, e, f, g, h) \
+    ((LOG_TOKEN_TYPES_7(a, b, c, d, e, f, g) + 1u) | LOG_TOKEN_AT(7, h))
+
+#else
+
+#define LOG_TOKEN(fmt, ...)   PRINTF(fmt, ##__VA_ARGS__)
+
+#endif /* LOG_TOKEN_ENABLE */
+
+#endif /* LOG_TOKEN_H_ */
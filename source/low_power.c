@@ -0,0 +1,221 @@
+/*
+ * @file    low_power.c
+ * @brief   Tickless idle on LPTMR with VLPS/WAIT entry through fsl_smc
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "board.h"
+#include "fsl_common.h"
+#include "fsl_smc.h"
+#include "fsl_device_registers.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "low_power.h"
+#include "trace_recorder.h"
+
+#define LPTMR_HZ          1000u    // LPO, prescaler bypassed
+#define LPTMR_MAX_COUNT   0xFFFFu
+#define LPTMR_INT_PRIO    192u
+#define CYCLES_PER_TICK   (configCPU_CLOCK_HZ / configTICK_RATE_HZ)
+#define CYCLES_PER_MS     (configCPU_CLOCK_HZ / LPTMR_HZ)
+
+static volatile uint32_t holds;
+static LowPowerStats_t stats;
+static volatile TickType_t deepNotBefore;
+
+// Between sleeps LPTMR runs with CMR = 0 and no interrupt: every LPO edge
+// sets TCF and resets CNR, so a sleep can start on an edge (see below).
+// Enabling it costs one or two extra LPO cycles of synchronisation; doing
+// it here, not in the sleep path, keeps that out of the idle spin.
+static void lptmr_idle(void) {
+    LPTMR0->CSR = 0;
+    LPTMR0->CMR = 0;
+    LPTMR0->CSR = LPTMR_CSR_TEN_MASK;
+}
+
+void LowPower_Init(void) {
+    memset(&stats, 0, sizeof(stats));
+    holds = 0u;
+
+    // PMPROT is write-once after reset.
+    SMC_SetPowerModeProtection(SMC, kSMC_AllowPowerModeVlp);
+
+    SIM->SCGC5 |= SIM_SCGC5_LPTMR_MASK;
+    LPTMR0->CSR = 0;
+    LPTMR0->PSR = LPTMR_PSR_PCS(1) | LPTMR_PSR_PBYP_MASK;   // LPO 1 kHz
+    lptmr_idle();
+
+    NVIC_SetPriority(LPTMR0_IRQn, LPTMR_INT_PRIO);
+    NVIC_ClearPendingIRQ(LPTMR0_IRQn);
+    NVIC_EnableIRQ(LPTMR0_IRQn);
+}
+
+void LowPower_Hold(uint32_t sources) {
+    UBaseType_t saved = portSET_INTERRUPT_MASK_FROM_ISR();
+    holds |= sources;
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(saved);
+}
+
+void LowPower_Release(uint32_t sources) {
+    UBaseType_t saved = portSET_INTERRUPT_MASK_FROM_ISR();
+    holds &= ~sources;
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(saved);
+}
+
+void LowPower_Defer(uint32_t ms) {
+    deepNotBefore = xTaskGetTickCount() + pdMS_TO_TICKS(ms);
+}
+
+void LowPower_GetStats(LowPowerStats_t *out) {
+    if (out == NULL) {
+        return;
+    }
+    taskENTER_CRITICAL();
+    *out = stats;
+    taskEXIT_CRITICAL();
+}
+
+// Only reached if the flag is still set when interrupts come back on; the
+// sleep path normally consumes it first.
+void LPTMR0_IRQHandler(void) {
+    TraceRecorder_IsrEnter();
+    LPTMR0->CSR = LPTMR_CSR_TEN_MASK | LPTMR_CSR_TCF_MASK;   // clear flag and interrupt, keep counting
+    TraceRecorder_IsrExit();
+}
+
+static uint32_t lptmr_elapsed_ms(void) {
+    LPTMR0->CNR = 0;                    // any write latches the counter
+    return LPTMR0->CNR;
+}
+
+// Restarts SysTick so its next interrupt comes `cycles` from now, then
+// back to whole ticks. LOAD is reloaded from VAL = 0 on the first count;
+// the normal period is written after that and applies from the next tick.
+static void systick_restart(uint32_t cycles) {
+    SysTick->LOAD = cycles - 1u;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    __NOP();
+    SysTick->LOAD = CYCLES_PER_TICK - 1u;
+}
+
+void LowPower_SuppressTicksAndSleep(TickType_t expectedIdleTicks) {
+    uint32_t sleepMs = (uint32_t)((uint64_t)expectedIdleTicks * LPTMR_HZ / configTICK_RATE_HZ);
+    if (sleepMs > LPTMR_MAX_COUNT) {
+        sleepMs = LPTMR_MAX_COUNT;
+    }
+    if (sleepMs < 2u) {
+        return;
+    }
+
+    __disable_irq();
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+        __enable_irq();
+        return;
+    }
+
+    // LPO runs free, so a count started at a random point is up to 1 ms
+    // short (0.5 ms on average), yet the whole sleepMs would be credited.
+    // Start on an edge instead: clear TCF and wait for the next one (at
+    // most 1 ms). CNR is 0 from that edge on, and TCF being set lets CMR be
+    // changed while the timer runs. SysTick stops right after, so the wait
+    // is counted in the tick like any other busy time.
+    LPTMR0->CSR = LPTMR_CSR_TEN_MASK | LPTMR_CSR_TCF_MASK;
+    while ((LPTMR0->CSR & LPTMR_CSR_TCF_MASK) == 0u) {
+    }
+
+    // Stop SysTick and keep what is left of the current tick. If the tick
+    // already expired its interrupt is pending: let it run instead.
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk;
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        __enable_irq();
+        return;
+    }
+    uint32_t tickLeft = SysTick->VAL;   // cycles until the next tick boundary
+    if (tickLeft == 0u) {
+        tickLeft = CYCLES_PER_TICK;
+    }
+
+    // Wake on a tick boundary: the rest of this tick plus whole ticks.
+    // While a Defer window is open, come back when it ends so deep sleep
+    // can be reconsidered.
+    bool deep = (holds == 0u) && ((int32_t)(xTaskGetTickCount() - deepNotBefore) >= 0);
+    uint64_t targetCycles = tickLeft + (uint64_t)(expectedIdleTicks - 1u) * CYCLES_PER_TICK;
+    if (!deep && holds == 0u) {
+        TickType_t deferTicks = deepNotBefore - xTaskGetTickCount();   // >= 1 here
+        uint64_t deferCycles = tickLeft + (uint64_t)(deferTicks - 1u) * CYCLES_PER_TICK;
+        if (deferCycles < targetCycles) {
+            targetCycles = deferCycles;
+        }
+    }
+    sleepMs = (uint32_t)(targetCycles / CYCLES_PER_MS);
+    if (sleepMs > LPTMR_MAX_COUNT) {
+        sleepMs = LPTMR_MAX_COUNT;
+    }
+    if (sleepMs < 2u) {
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        __enable_irq();
+        return;
+    }
+
+    // TCF is set when CNR moves on from CMR: sleepMs whole LPO periods.
+    LPTMR0->CMR = sleepMs - 1u;
+    LPTMR0->CSR = LPTMR_CSR_TIE_MASK | LPTMR_CSR_TEN_MASK | LPTMR_CSR_TCF_MASK;
+
+    // Pending interrupts still wake WFI with PRIMASK set; they run once
+    // interrupts are re-enabled below, after the tick count is corrected.
+    if (deep) {
+        SMC_PreEnterStopModes();
+        (void)SMC_SetPowerModeVlps(SMC);
+        SMC_PostExitStopModes();
+    } else {
+        SMC_PreEnterWaitModes();
+        (void)SMC_SetPowerModeWait(SMC);
+        SMC_PostExitWaitModes();
+    }
+
+    // Whole LPO periods since the edge. An early wake drops the part of the
+    // period it interrupted, so the tick count may fall behind, never ahead.
+    uint32_t sleptMs;
+    bool expired = (LPTMR0->CSR & LPTMR_CSR_TCF_MASK) != 0u;
+    if (expired) {
+        sleptMs = sleepMs;
+        LPTMR0->CMR = 0;                                        // TCF still set
+        LPTMR0->CSR = LPTMR_CSR_TEN_MASK | LPTMR_CSR_TCF_MASK;  // back to idle counting
+    } else {
+        sleptMs = lptmr_elapsed_ms();
+        stats.earlyWakes++;
+        lptmr_idle();   // CMR is locked until TCF: restart the timer
+    }
+    NVIC_ClearPendingIRQ(LPTMR0_IRQn);
+
+    // Time since the last tick boundary: the part of the tick that had
+    // elapsed before sleeping plus the sleep. Whole ticks step the count;
+    // SysTick restarts with the rest of the tick still to go, so nothing
+    // is dropped or stretched.
+    uint64_t elapsed = (uint64_t)(CYCLES_PER_TICK - tickLeft) + (uint64_t)sleptMs * CYCLES_PER_MS;
+    TickType_t ticks = (TickType_t)(elapsed / CYCLES_PER_TICK);
+    uint32_t intoTick = (uint32_t)(elapsed % CYCLES_PER_TICK);
+    // sleptMs * CYCLES_PER_MS <= targetCycles <= tickLeft + (expectedIdleTicks
+    // - 1) whole ticks, so elapsed is at most expectedIdleTicks whole ticks,
+    // even when the sleep started part-way through a tick. Kept as a guard.
+    if (ticks > expectedIdleTicks) {
+        ticks = expectedIdleTicks;
+        intoTick = 0u;
+    }
+    systick_restart(CYCLES_PER_TICK - intoTick);
+    vTaskStepTick(ticks);
+
+    stats.sleeps++;
+    stats.sleptMs += sleptMs;
+    if (deep) {
+        stats.deepSleeps++;
+        stats.deepMs += sleptMs;
+    }
+    __enable_irq();
+}
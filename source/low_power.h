@@ -0,0 +1,50 @@
+#ifndef LOW_POWER_H_
+#define LOW_POWER_H_
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+// Tickless idle: when every task is blocked for at least
+// configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks, SysTick is stopped, LPTMR
+// (1 kHz LPO, keeps running in VLPS) is armed for the expected idle time and
+// the core sleeps. On wake the kernel tick count is stepped by the time
+// LPTMR measured, counted from the last tick boundary, and SysTick resumes
+// part-way through a tick so the tick keeps real time across sleeps.
+//
+// VLPS stops the bus clock and HIRC, so PIT, TPM and UART2 halt. Drivers
+// that must keep running hold off deep sleep; the idle task then uses WAIT
+// (core clock gated only) instead.
+
+typedef enum {
+    LOW_POWER_HOLD_PWM     = (1u << 0),   // a TPM output is driving a load
+    LOW_POWER_HOLD_AUDIO   = (1u << 1),   // DAC/DMA playback in progress
+    LOW_POWER_HOLD_UART    = (1u << 2),   // bridge line being received
+    LOW_POWER_HOLD_DHT     = (1u << 3),   // DHT11 frame being captured on TPM1
+    LOW_POWER_HOLD_UART_TX = (1u << 4),   // bridge lines still going out
+} LowPowerHold_t;
+
+typedef struct {
+    uint32_t sleeps;       // tickless sleeps entered
+    uint32_t deepSleeps;   // ... of which in VLPS
+    uint32_t earlyWakes;   // woken by an interrupt before LPTMR expired
+    uint32_t sleptMs;      // total time with the tick suppressed
+    uint32_t deepMs;       // ... of which in VLPS
+} LowPowerStats_t;
+
+void LowPower_Init(void);
+
+// Safe from tasks and ISRs.
+void LowPower_Hold(uint32_t sources);
+void LowPower_Release(uint32_t sources);
+// Task context: no deep sleep for the next ms milliseconds (e.g. after a
+// line arrives, in case the peer sends more, or while a reply is due).
+// Unlike a hold it lapses on its own.
+void LowPower_Defer(uint32_t ms);
+
+void LowPower_GetStats(LowPowerStats_t *out);
+
+// portSUPPRESS_TICKS_AND_SLEEP (FreeRTOSConfig_Gen.h)
+void LowPower_SuppressTicksAndSleep(TickType_t expectedIdleTicks);
+
+#endif /* LOW_POWER_H_ */
@@ -9,7 +9,18 @@
 #include "semphr.h"
 
 #include "actuator_driver.h"
+#include "actuator_mailbox.h"
+#include "audio_player.h"
+#include "dht11.h"
+#include "event_hub.h"
+#include "low_power.h"
+#include "plant_rules.h"
+#include "rtos_bench.h"
+#include "rtos_objects.h"
+#include "runtime_clock.h"
+#include "pwm_service.h"
 #include "sensor.h"
+#include "trace_recorder.h"
 #include "uart_bridge.h"
 
 #define UART_BRIDGE_BAUDRATE 9600u
@@ -23,19 +34,36 @@ int main(void)
     BOARD_InitDebugConsole();
 #endif
 
+#ifdef RTOS_BENCH
+    // Benchmark firmware: only the bench tasks are created (rtos_bench.h).
+    RtosObjects_Init();
+    RuntimeClock_Init();
+    LowPower_Init();
+    PWM_Init();
+    Bench_Init();
+#else
     static SensorData_t gSensorData;
-    SemaphoreHandle_t sensorDataMutex = xSemaphoreCreateMutex();
-    configASSERT(sensorDataMutex != NULL);
+    RtosObjects_Init();
+    SemaphoreHandle_t sensorDataMutex = RTOS_SEMAPHORE(SensorData);
 
+    RuntimeClock_Init();
+    TraceRecorder_Start();
+    LowPower_Init();
+    PWM_Init();
     Actuators_Init();
+    ActuatorMailbox_Init();
+    Audio_Init();
+    PlantRules_Init();
     Sensors_Init(&gSensorData, sensorDataMutex);
+    Dht11_Init();
 
     UART_Bridge_Init(UART_BRIDGE_BAUDRATE);
+    EventHub_Init();
     UART_Bridge_SetSensorDataHandle(&gSensorData, sensorDataMutex);
+#endif
 
-    xTaskCreate(Sensor_Task, "SensorTask", configMINIMAL_STACK_SIZE + 256, NULL, 2, NULL);
-    xTaskCreate(Actuator_Task, "ActuatorTask", configMINIMAL_STACK_SIZE + 256, NULL, 1, NULL);
-    UART_Bridge_StartTasks(3, 2);
+    // Task list, stacks and priorities: see rtos_objects.h
+    RtosObjects_StartTasks();
 
     vTaskStartScheduler();
     for (;;) {
@@ -0,0 +1,124 @@
+/*
+ * @file    mutex_profile.c
+ * @brief   Wait time, hold time and priority-inheritance counters per mutex
+ */
+
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "mutex_profile.h"
+#include "runtime_clock.h"
+
+typedef struct {
+    SemaphoreHandle_t handle;
+    uint64_t takenCycles;        // written and read only by the holder
+    MutexStat_t stat;
+} MutexRecord_t;
+
+static MutexRecord_t records[MUTEX_PROFILE_MAX];
+static uint8_t recordCount;
+
+static MutexRecord_t *find(SemaphoreHandle_t mutex) {
+    for (uint8_t i = 0; i < recordCount; ++i) {
+        if (records[i].handle == mutex) {
+            return &records[i];
+        }
+    }
+    return NULL;
+}
+
+// Called from RtosObjects_Init, before the scheduler starts.
+void MutexProfile_Register(SemaphoreHandle_t mutex, const char *name) {
+    configASSERT(mutex != NULL);
+    configASSERT(recordCount < MUTEX_PROFILE_MAX);
+    records[recordCount].handle = mutex;
+    records[recordCount].stat.name = name;
+    recordCount++;
+}
+
+BaseType_t MutexProfile_Take(SemaphoreHandle_t mutex, TickType_t timeout) {
+    MutexRecord_t *r = find(mutex);
+    if (r == NULL) {
+        return xSemaphoreTake(mutex, timeout);
+    }
+
+    UBaseType_t ownPrio = uxTaskBasePriorityGet(NULL);
+    bool contended = false;
+    bool inherit = false;
+    taskENTER_CRITICAL();
+    TaskHandle_t holder = xSemaphoreGetMutexHolder(mutex);   // the kernel's view, not a shadow
+    if (holder != NULL) {
+        contended = true;
+        // Only a waiter that actually blocks triggers inheritance.
+        inherit = (timeout != 0u) && (uxTaskPriorityGet(holder) < ownPrio);
+    }
+    taskEXIT_CRITICAL();
+
+    uint64_t t0 = RuntimeClock_Cycles();
+    BaseType_t ok = xSemaphoreTake(mutex, timeout);
+    uint64_t t1 = RuntimeClock_Cycles();
+    uint32_t waitUs = RuntimeClock_CyclesToUs(t1 - t0);
+
+    taskENTER_CRITICAL();
+    MutexStat_t *st = &r->stat;
+    st->waitTotalUs += waitUs;
+    if (waitUs > st->waitMaxUs) {
+        st->waitMaxUs = waitUs;
+    }
+    if (contended) {
+        st->contended++;
+        if (ownPrio > st->waiterPrioMax) {
+            st->waiterPrioMax = (uint8_t)ownPrio;
+        }
+    }
+    if (inherit) {
+        st->inherits++;
+    }
+    if (ok == pdTRUE) {
+        st->takes++;
+        if (ownPrio > st->ownerPrioMax) {
+            st->ownerPrioMax = (uint8_t)ownPrio;
+        }
+        r->takenCycles = t1;
+    } else {
+        st->timeouts++;
+    }
+    taskEXIT_CRITICAL();
+    return ok;
+}
+
+BaseType_t MutexProfile_Give(SemaphoreHandle_t mutex) {
+    MutexRecord_t *r = find(mutex);
+    if (r == NULL) {
+        return xSemaphoreGive(mutex);
+    }
+
+    // Stop the clock before the give: it may switch to a waiter, whose
+    // Take then overwrites takenCycles. Only a give that succeeded (the
+    // caller really held it) counts as a hold.
+    uint32_t holdUs = RuntimeClock_CyclesToUs(RuntimeClock_Cycles() - r->takenCycles);
+    BaseType_t ok = xSemaphoreGive(mutex);
+    if (ok == pdPASS) {
+        taskENTER_CRITICAL();
+        MutexStat_t *st = &r->stat;
+        st->holdTotalUs += holdUs;
+        if (holdUs > st->holdMaxUs) {
+            st->holdMaxUs = holdUs;
+        }
+        taskEXIT_CRITICAL();
+    }
+    return ok;
+}
+
+uint8_t MutexProfile_Get(MutexStat_t *out, uint8_t max) {
+    uint8_t n = 0;
+    taskENTER_CRITICAL();
+    for (; n < recordCount && n < max; ++n) {
+        out[n] = records[n].stat;
+    }
+    taskEXIT_CRITICAL();
+    return n;
+}
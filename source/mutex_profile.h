@@ -0,0 +1,48 @@
+#ifndef MUTEX_PROFILE_H_
+#define MUTEX_PROFILE_H_
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+// Instrumented take/give for the mutexes in RTOS_SEMAPHORE_TABLE. Every
+// Mutex entry registers itself at creation (rtos_objects.c). Call
+// MutexProfile_Take/Give instead of xSemaphoreTake/xSemaphoreGive;
+// unregistered handles pass straight through.
+//
+// Per mutex (times from runtime_clock.h, microseconds):
+//   takes, contended     acquisitions, and how many found it held
+//   timeouts             takes that gave up (the caller skipped its work)
+//   wait max/total       time blocked in Take, successful or not
+//   hold max/total       Take -> Give of the owner
+//   inherit              contended takes by a higher-priority task, so the
+//                        kernel raised the holder's priority
+//   owner/waiter prio    highest base priority seen holding / blocking
+// The STATS report carries one "STAT mx ..." line per mutex.
+
+#define MUTEX_PROFILE_MAX    4u
+
+typedef struct {
+    const char *name;
+    uint32_t takes;
+    uint32_t contended;
+    uint32_t timeouts;
+    uint32_t inherits;
+    uint32_t waitMaxUs;
+    uint64_t waitTotalUs;    // 64-bit: 32 bits of us wrap after ~71 min
+    uint32_t holdMaxUs;
+    uint64_t holdTotalUs;
+    uint8_t ownerPrioMax;
+    uint8_t waiterPrioMax;
+} MutexStat_t;
+
+void MutexProfile_Register(SemaphoreHandle_t mutex, const char *name);
+
+BaseType_t MutexProfile_Take(SemaphoreHandle_t mutex, TickType_t timeout);
+BaseType_t MutexProfile_Give(SemaphoreHandle_t mutex);
+
+// Copies up to max entries (registration order); returns the number copied.
+uint8_t MutexProfile_Get(MutexStat_t *out, uint8_t max);
+
+#endif /* MUTEX_PROFILE_H_ */
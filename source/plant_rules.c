@@ -0,0 +1,356 @@
+/*
+ * @file    plant_rules.c
+ * @brief   Predicate bitmask -> decision table rules engine for plant state
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "cmd_token.h"
+#include "plant_rules.h"
+
+typedef struct {
+    bool enabled;
+    PlantField_t field;
+    PlantCompare_t cmp;
+    float threshold;
+    float hysteresis;     // release point is this far back past the threshold
+    TickType_t dwell;     // raw condition must hold this long to flip state
+    bool seeded;          // state taken from a reading since (re)definition
+    bool state;           // debounced predicate value (the mask bit)
+    bool pending;         // raw condition currently disagrees with state
+    TickType_t pendingSince;
+} PlantPredicate_t;
+
+static PlantPredicate_t predicates[PLANT_MAX_PREDICATES];
+static PlantDecision_t table[PLANT_TABLE_SIZE];
+// A table being loaded; Evaluate keeps using `table` until it is committed.
+static PlantDecision_t staged[PLANT_TABLE_SIZE];
+static bool staging;
+
+static const char *const kFieldNames[PLANT_FIELD_COUNT] = { "water", "photo", "temp", "hum" };
+static const char *const kActionNames[PLANT_ACTION_COUNT] = { "none", "happy", "stressed", "alert" };
+
+static float field_value(const SensorData_t *data, PlantField_t field) {
+    switch (field) {
+    case PLANT_FIELD_WATER:       return (float)data->water_level;
+    case PLANT_FIELD_LIGHT:       return (float)data->light_intensity;
+    case PLANT_FIELD_TEMPERATURE: return data->temperature;
+    case PLANT_FIELD_HUMIDITY:    return data->humidity;
+    default:                      return 0.0f;
+    }
+}
+
+void PlantRules_Init(void) {
+    memset(predicates, 0, sizeof(predicates));
+
+    // Same thresholds and comparisons as the old hard-coded Actuator_Task.
+    PlantRules_SetPredicate(PLANT_PRED_WATER_WET, PLANT_FIELD_WATER, PLANT_CMP_GE, 1800.0f);
+    PlantRules_SetPredicate(PLANT_PRED_LIGHT_BRIGHT, PLANT_FIELD_LIGHT, PLANT_CMP_LE, 5.0f);
+    PlantRules_SetPredicate(PLANT_PRED_TEMP_HIGH, PLANT_FIELD_TEMPERATURE, PLANT_CMP_LE, 40.0f);
+    PlantRules_SetPredicate(PLANT_PRED_HUMIDITY_HIGH, PLANT_FIELD_HUMIDITY, PLANT_CMP_LE, 50.0f);
+
+    // Bands sized to the sensor noise; dwell spans a few 2 s evaluations.
+    PlantRules_SetHysteresis(PLANT_PRED_WATER_WET, 100.0f, 4000u);
+    PlantRules_SetHysteresis(PLANT_PRED_LIGHT_BRIGHT, 2.0f, 4000u);
+    PlantRules_SetHysteresis(PLANT_PRED_TEMP_HIGH, 1.0f, 10000u);
+    PlantRules_SetHysteresis(PLANT_PRED_HUMIDITY_HIGH, 3.0f, 10000u);
+
+    // Stressed unless all four conditions hold.
+    const uint8_t all = (1u << PLANT_PRED_WATER_WET) | (1u << PLANT_PRED_LIGHT_BRIGHT) |
+                        (1u << PLANT_PRED_TEMP_HIGH) | (1u << PLANT_PRED_HUMIDITY_HIGH);
+    PlantRules_ClearTable(PLANT_ACTION_STRESSED, 0u);
+    PlantRules_AddRule(all, all, PLANT_ACTION_HAPPY, 0u);
+    PlantRules_CommitTable();
+}
+
+BaseType_t PlantRules_SetPredicate(uint8_t bit, PlantField_t field, PlantCompare_t cmp, float threshold) {
+    if (bit >= PLANT_MAX_PREDICATES || field >= PLANT_FIELD_COUNT) {
+        return pdFAIL;
+    }
+    taskENTER_CRITICAL();
+    predicates[bit].field = field;
+    predicates[bit].cmp = cmp;
+    predicates[bit].threshold = threshold;
+    predicates[bit].hysteresis = 0.0f;
+    predicates[bit].dwell = 0;
+    predicates[bit].seeded = false;
+    predicates[bit].state = false;
+    predicates[bit].pending = false;
+    predicates[bit].enabled = true;
+    taskEXIT_CRITICAL();
+    return pdPASS;
+}
+
+BaseType_t PlantRules_SetHysteresis(uint8_t bit, float band, uint32_t dwellMs) {
+    if (bit >= PLANT_MAX_PREDICATES || !predicates[bit].enabled || band < 0.0f) {
+        return pdFAIL;
+    }
+    taskENTER_CRITICAL();
+    predicates[bit].hysteresis = band;
+    predicates[bit].dwell = pdMS_TO_TICKS(dwellMs);
+    taskEXIT_CRITICAL();
+    return pdPASS;
+}
+
+BaseType_t PlantRules_DisablePredicate(uint8_t bit) {
+    if (bit >= PLANT_MAX_PREDICATES) {
+        return pdFAIL;
+    }
+    predicates[bit].enabled = false;
+    return pdPASS;
+}
+
+BaseType_t PlantRules_SetThreshold(uint8_t bit, float threshold) {
+    if (bit >= PLANT_MAX_PREDICATES || !predicates[bit].enabled) {
+        return pdFAIL;
+    }
+    taskENTER_CRITICAL();
+    predicates[bit].threshold = threshold;
+    taskEXIT_CRITICAL();
+    return pdPASS;
+}
+
+// Table loading runs in one task (init, then the bridge's command
+// handler), so `staged` itself needs no lock; only the swap does.
+void PlantRules_ClearTable(PlantAction_t action, uint8_t priority) {
+    for (uint32_t i = 0; i < PLANT_TABLE_SIZE; ++i) {
+        staged[i].action = (uint8_t)action;
+        staged[i].priority = priority;
+    }
+    staging = true;
+}
+
+BaseType_t PlantRules_AddRule(uint8_t care, uint8_t match, PlantAction_t action, uint8_t priority) {
+    if (action >= PLANT_ACTION_COUNT || care >= PLANT_TABLE_SIZE || match >= PLANT_TABLE_SIZE ||
+        (match & ~care) != 0u) {
+        return pdFAIL;
+    }
+    // Without a table being loaded the rule patches the live one, whole.
+    PlantDecision_t *dst = staging ? staged : table;
+    taskENTER_CRITICAL();
+    for (uint32_t i = 0; i < PLANT_TABLE_SIZE; ++i) {
+        if ((i & care) == match) {
+            dst[i].action = (uint8_t)action;
+            dst[i].priority = priority;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return pdPASS;
+}
+
+BaseType_t PlantRules_CommitTable(void) {
+    if (!staging) {
+        return pdFAIL;
+    }
+    taskENTER_CRITICAL();
+    memcpy(table, staged, sizeof(table));
+    taskEXIT_CRITICAL();
+    staging = false;
+    return pdPASS;
+}
+
+// Raw condition with hysteresis: once set, a predicate only clears after the
+// value moves `hysteresis` back past the threshold.
+static bool predicate_raw(const PlantPredicate_t *p, float v) {
+    float band = p->state ? p->hysteresis : 0.0f;
+    return (p->cmp == PLANT_CMP_GE) ? (v >= p->threshold - band)
+                                    : (v <= p->threshold + band);
+}
+
+uint8_t PlantRules_Evaluate(const SensorData_t *data, PlantDecision_t *out) {
+    uint8_t mask = 0u;
+    if (data == NULL) {
+        return 0u;
+    }
+    TickType_t now = xTaskGetTickCount();
+
+    taskENTER_CRITICAL();
+    for (uint8_t bit = 0; bit < PLANT_MAX_PREDICATES; ++bit) {
+        PlantPredicate_t *p = &predicates[bit];
+        if (!p->enabled) {
+            continue;
+        }
+        bool raw = predicate_raw(p, field_value(data, p->field));
+        if (!p->seeded) {
+            // A new predicate starts in the state the first reading gives
+            // it; it has no previous state to transition from.
+            p->state = raw;
+            p->seeded = true;
+        }
+        if (raw == p->state) {
+            p->pending = false;
+        } else if (!p->pending) {
+            p->pending = true;
+            p->pendingSince = now;
+        }
+        // Flip only after the disagreement has lasted the whole dwell time.
+        if (p->pending && (now - p->pendingSince) >= p->dwell) {
+            p->state = raw;
+            p->pending = false;
+        }
+        if (p->state) {
+            mask |= (uint8_t)(1u << bit);
+        }
+    }
+    if (out) {
+        *out = table[mask];
+    }
+    taskEXIT_CRITICAL();
+    return mask;
+}
+
+/* -------------------- COMMANDS -------------------- */
+static int lookup(const char *tok, const char *const *names, int count) {
+    for (int i = 0; i < count; ++i) {
+        if (CmdToken_Equals(tok, names[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// strtoul would take "-1" as ULONG_MAX and saturate on overflow.
+static bool parse_uint(const char *tok, uint32_t *out) {
+    if (tok[0] == '-' || tok[0] == '+') {
+        return false;
+    }
+    char *end = NULL;
+    errno = 0;
+    unsigned long v = strtoul(tok, &end, 0);   // accepts 0x.. masks
+    if (end == tok || *end != '\0' || errno == ERANGE || v > UINT32_MAX) {
+        return false;
+    }
+    *out = (uint32_t)v;
+    return true;
+}
+
+// Predicate bit, checked before it is narrowed to uint8_t.
+static bool parse_bit(const char *tok, uint8_t *out) {
+    uint32_t v;
+    if (!parse_uint(tok, &v) || v >= PLANT_MAX_PREDICATES) {
+        return false;
+    }
+    *out = (uint8_t)v;
+    return true;
+}
+
+static bool parse_float(const char *tok, float *out) {
+    char *end = NULL;
+    errno = 0;
+    float v = strtof(tok, &end);
+    if (end == tok || *end != '\0' || errno == ERANGE || !isfinite(v)) {
+        return false;
+    }
+    *out = v;
+    return true;
+}
+
+// TH <bit> <threshold>
+static bool cmd_threshold(const char *args) {
+    char a[12], b[16];
+    uint8_t bit;
+    float th;
+    return CmdToken_Next(&args, a, sizeof(a)) && CmdToken_Next(&args, b, sizeof(b)) &&
+           parse_bit(a, &bit) && parse_float(b, &th) &&
+           PlantRules_SetThreshold(bit, th) == pdPASS;
+}
+
+// HYST <bit> <band> <dwell-ms>
+static bool cmd_hysteresis(const char *args) {
+    char a[12], b[16], d[12];
+    uint8_t bit;
+    uint32_t dwell;
+    float band;
+    return CmdToken_Next(&args, a, sizeof(a)) && CmdToken_Next(&args, b, sizeof(b)) &&
+           CmdToken_Next(&args, d, sizeof(d)) && parse_bit(a, &bit) && parse_float(b, &band) &&
+           parse_uint(d, &dwell) && PlantRules_SetHysteresis(bit, band, dwell) == pdPASS;
+}
+
+// PRED <bit> <water|photo|temp|hum> <ge|le> <threshold>   or   PRED <bit> off
+static bool cmd_predicate(const char *args) {
+    char a[12], f[12], c[8], t[16];
+    uint8_t bit;
+    float th;
+    if (!CmdToken_Next(&args, a, sizeof(a)) || !parse_bit(a, &bit) || !CmdToken_Next(&args, f, sizeof(f))) {
+        return false;
+    }
+    if (CmdToken_Equals(f, "off")) {
+        return PlantRules_DisablePredicate(bit) == pdPASS;
+    }
+    int field = lookup(f, kFieldNames, PLANT_FIELD_COUNT);
+    if (field < 0 || !CmdToken_Next(&args, c, sizeof(c)) || !CmdToken_Next(&args, t, sizeof(t)) ||
+        !parse_float(t, &th)) {
+        return false;
+    }
+    PlantCompare_t cmp;
+    if (CmdToken_Equals(c, "ge"))      cmp = PLANT_CMP_GE;
+    else if (CmdToken_Equals(c, "le")) cmp = PLANT_CMP_LE;
+    else return false;
+    return PlantRules_SetPredicate(bit, (PlantField_t)field, cmp, th) == pdPASS;
+}
+
+// RULE <care> <match> <action> [priority]
+static bool cmd_rule(const char *args) {
+    char a[12], b[12], act[12], pr[8];
+    uint32_t care, match, prio = 0u;
+    if (!CmdToken_Next(&args, a, sizeof(a)) || !CmdToken_Next(&args, b, sizeof(b)) ||
+        !CmdToken_Next(&args, act, sizeof(act)) || !parse_uint(a, &care) || !parse_uint(b, &match) ||
+        care >= PLANT_TABLE_SIZE || match >= PLANT_TABLE_SIZE) {
+        return false;
+    }
+    int action = lookup(act, kActionNames, PLANT_ACTION_COUNT);
+    if (action < 0 || (!CmdToken_AtEnd(args) &&
+                       (!CmdToken_Next(&args, pr, sizeof(pr)) || !parse_uint(pr, &prio) || prio > UINT8_MAX))) {
+        return false;
+    }
+    return PlantRules_AddRule((uint8_t)care, (uint8_t)match, (PlantAction_t)action, (uint8_t)prio) == pdPASS;
+}
+
+// RULES <default-action> [priority]  -- start loading a new table
+// RULES END                            -- switch to it
+static bool cmd_rules(const char *args) {
+    char act[12], pr[8];
+    uint32_t prio = 0u;
+    if (!CmdToken_Next(&args, act, sizeof(act))) {
+        return false;
+    }
+    if (CmdToken_Equals(act, "end")) {
+        return PlantRules_CommitTable() == pdPASS;
+    }
+    int action = lookup(act, kActionNames, PLANT_ACTION_COUNT);
+    if (action < 0 || (!CmdToken_AtEnd(args) &&
+                       (!CmdToken_Next(&args, pr, sizeof(pr)) || !parse_uint(pr, &prio) || prio > UINT8_MAX))) {
+        return false;
+    }
+    PlantRules_ClearTable((PlantAction_t)action, (uint8_t)prio);
+    return true;
+}
+
+bool PlantRules_HandleCommand(const char *line, char *reply, size_t replyLen) {
+    char verb[8];
+    const char *args = line;
+    bool ok;
+
+    if (line == NULL || !CmdToken_Next(&args, verb, sizeof(verb))) {
+        return false;
+    }
+    if (CmdToken_Equals(verb, "TH"))         ok = cmd_threshold(args);
+    else if (CmdToken_Equals(verb, "HYST"))  ok = cmd_hysteresis(args);
+    else if (CmdToken_Equals(verb, "PRED"))  ok = cmd_predicate(args);
+    else if (CmdToken_Equals(verb, "RULE"))  ok = cmd_rule(args);
+    else if (CmdToken_Equals(verb, "RULES")) ok = cmd_rules(args);
+    else return false;
+
+    if (reply && replyLen) {
+        snprintf(reply, replyLen, "%s %s\n", ok ? "OK" : "ERR", verb);
+    }
+    return true;
+}
@@ -0,0 +1,87 @@
+#ifndef PLANT_RULES_H_
+#define PLANT_RULES_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+#include "sensor.h"
+
+// Each predicate compares one sensor field against a threshold and owns one
+// bit of the condition mask. The mask indexes a decision table, so a
+// decision is one lookup no matter how many rules were loaded.
+//
+// Predicates are debounced: a hysteresis band moves the release point back
+// from the threshold, and the raw condition has to persist for a dwell time
+// before the mask bit flips. The mask, and so the decision, only changes on
+// real state transitions.
+
+#define PLANT_MAX_PREDICATES   6u
+#define PLANT_TABLE_SIZE       (1u << PLANT_MAX_PREDICATES)
+
+// Decisions at or above this priority go through the mailbox alert lane.
+#define PLANT_PRIORITY_ALERT   2u
+
+typedef enum {
+    PLANT_FIELD_WATER = 0,
+    PLANT_FIELD_LIGHT,
+    PLANT_FIELD_TEMPERATURE,
+    PLANT_FIELD_HUMIDITY,
+    PLANT_FIELD_COUNT
+} PlantField_t;
+
+typedef enum {
+    PLANT_CMP_GE = 0,
+    PLANT_CMP_LE
+} PlantCompare_t;
+
+typedef enum {
+    PLANT_ACTION_NONE = 0,
+    PLANT_ACTION_HAPPY,
+    PLANT_ACTION_STRESSED,
+    PLANT_ACTION_ALERT,
+    PLANT_ACTION_COUNT
+} PlantAction_t;
+
+// Default predicate bits (same conditions Actuator_Task used to hard-code).
+enum {
+    PLANT_PRED_WATER_WET = 0,
+    PLANT_PRED_LIGHT_BRIGHT,
+    PLANT_PRED_TEMP_HIGH,
+    PLANT_PRED_HUMIDITY_HIGH
+};
+
+typedef struct {
+    uint8_t action;    // PlantAction_t
+    uint8_t priority;
+} PlantDecision_t;
+
+void PlantRules_Init(void);
+
+BaseType_t PlantRules_SetPredicate(uint8_t bit, PlantField_t field, PlantCompare_t cmp, float threshold);
+BaseType_t PlantRules_DisablePredicate(uint8_t bit);
+BaseType_t PlantRules_SetThreshold(uint8_t bit, float threshold);
+// SetPredicate resets the band and dwell to zero.
+BaseType_t PlantRules_SetHysteresis(uint8_t bit, float band, uint32_t dwellMs);
+
+// Table loading: ClearTable starts a new table with every entry set to a
+// default, AddRule applies rules to it, and CommitTable swaps it in at once,
+// so Evaluate never sees a half-loaded table. A rule writes all entries
+// whose bits under `care` equal `match`; later rules override earlier ones.
+// AddRule outside a load patches the live table, one whole rule at a time.
+void PlantRules_ClearTable(PlantAction_t action, uint8_t priority);
+BaseType_t PlantRules_AddRule(uint8_t care, uint8_t match, PlantAction_t action, uint8_t priority);
+BaseType_t PlantRules_CommitTable(void);
+
+// Returns the condition mask and the decision it selects.
+uint8_t PlantRules_Evaluate(const SensorData_t *data, PlantDecision_t *out);
+
+// Text commands from the ESP32 bridge (TH/HYST/PRED/RULE/RULES). A table
+// is loaded as RULES <default> [prio], RULE lines, then RULES END. Returns
+// false if the line is not a rules command; otherwise reply holds
+// "OK ..." / "ERR ...".
+bool PlantRules_HandleCommand(const char *line, char *reply, size_t replyLen);
+
+#endif /* PLANT_RULES_H_ */
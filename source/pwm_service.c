@@ -0,0 +1,294 @@
+/*
+ * @file    pwm_service.c
+ * @brief   Shared TPM0/TPM1/TPM2 PWM channel allocator
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "board.h"
+#include "fsl_common.h"
+#include "fsl_clock.h"
+#include "fsl_device_registers.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "low_power.h"
+#include "pwm_service.h"
+
+#define TPM_MAX_PRESCALE   7u       // divide by 128
+#define TPM_MAX_MOD        0xFFFEu  // full duty writes CnV = MOD + 1, which must fit in 16 bits
+
+typedef struct {
+    bool inUse;
+    PwmTimer_t timer;
+    uint8_t channel;
+    uint32_t minHz;
+    uint32_t maxHz;
+    uint16_t duty;
+} PwmChannelState_t;
+
+typedef struct {
+    bool reserved;     // handed out whole via PWM_ReserveTimer
+    bool running;
+    uint8_t users;
+    uint8_t prescale;  // log2 of the divider, fixed by the first channel
+    uint32_t hz;
+} PwmTimerState_t;
+
+static TPM_Type *const kTimers[PWM_TIMER_COUNT] = { TPM0, TPM1, TPM2 };
+static const uint32_t kTimerGates[PWM_TIMER_COUNT] = {
+    SIM_SCGC6_TPM0_MASK, SIM_SCGC6_TPM1_MASK, SIM_SCGC6_TPM2_MASK
+};
+static const uint8_t kTimerChannels[PWM_TIMER_COUNT] = { 6u, 2u, 2u };
+
+static PwmChannelState_t channels[PWM_MAX_CHANNELS];
+static PwmTimerState_t timers[PWM_TIMER_COUNT];
+static uint32_t timerClockHz;
+static uint32_t drivingMask;     // bit per handle with a non-zero duty
+
+static void port_clock_enable(PORT_Type *port) {
+    if (port == PORTA)      SIM->SCGC5 |= SIM_SCGC5_PORTA_MASK;
+    else if (port == PORTB) SIM->SCGC5 |= SIM_SCGC5_PORTB_MASK;
+    else if (port == PORTC) SIM->SCGC5 |= SIM_SCGC5_PORTC_MASK;
+    else if (port == PORTD) SIM->SCGC5 |= SIM_SCGC5_PORTD_MASK;
+    else if (port == PORTE) SIM->SCGC5 |= SIM_SCGC5_PORTE_MASK;
+}
+
+static bool valid_handle(PwmHandle_t h) {
+    return h >= 0 && h < (PwmHandle_t)PWM_MAX_CHANNELS && channels[h].inUse;
+}
+
+// Smallest prescaler whose 16-bit period still reaches minHz: the best
+// resolution that covers the channel's whole range downwards.
+static uint8_t prescale_for(uint32_t minHz) {
+    uint8_t p = 0;
+    while (p < TPM_MAX_PRESCALE && (timerClockHz >> p) / minHz > TPM_MAX_MOD + 1u) {
+        p++;
+    }
+    return p;
+}
+
+// MOD for hz at the timer's fixed prescaler; false if it does not fit.
+static bool compute_mod(PwmTimer_t t, uint32_t hz, uint32_t *mod) {
+    if (hz == 0u) {
+        return false;
+    }
+    uint32_t counts = (timerClockHz >> timers[t].prescale) / hz;
+    if (counts < 2u || counts - 1u > TPM_MAX_MOD) {
+        return false;
+    }
+    *mod = counts - 1u;
+    return true;
+}
+
+static uint32_t duty_to_cnv(uint16_t duty, uint32_t mod) {
+    if (duty >= PWM_DUTY_MAX) {
+        return mod + 1u;   // edge-aligned: CnV > MOD keeps the output asserted
+    }
+    return ((uint32_t)duty * (mod + 1u)) >> 16;
+}
+
+static bool timer_accepts(PwmTimer_t t, uint32_t hz, PwmHandle_t except) {
+    for (PwmHandle_t i = 0; i < (PwmHandle_t)PWM_MAX_CHANNELS; ++i) {
+        if (i == except || !channels[i].inUse || channels[i].timer != t) {
+            continue;
+        }
+        if (hz < channels[i].minHz || hz > channels[i].maxHz) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void write_channel_values(PwmTimer_t t) {
+    TPM_Type *tpm = kTimers[t];
+    for (PwmHandle_t i = 0; i < (PwmHandle_t)PWM_MAX_CHANNELS; ++i) {
+        if (channels[i].inUse && channels[i].timer == t) {
+            tpm->CONTROLS[channels[i].channel].CnV = duty_to_cnv(channels[i].duty, tpm->MOD);
+        }
+    }
+}
+
+// While running only MOD and the CnVs change: they are buffered and latch
+// together at the next overflow, so the counter the other channels share
+// never stops. PS is only writable with CMOD = 0, which is why it is fixed
+// once the timer starts.
+static bool timer_program(PwmTimer_t t, uint32_t hz) {
+    TPM_Type *tpm = kTimers[t];
+    uint32_t mod;
+
+    if (!compute_mod(t, hz, &mod)) {
+        return false;
+    }
+
+    taskENTER_CRITICAL();
+    if (timers[t].running) {
+        tpm->MOD = mod;
+        for (PwmHandle_t i = 0; i < (PwmHandle_t)PWM_MAX_CHANNELS; ++i) {
+            if (channels[i].inUse && channels[i].timer == t) {
+                tpm->CONTROLS[channels[i].channel].CnV = duty_to_cnv(channels[i].duty, mod);
+            }
+        }
+    } else {
+        tpm->SC = 0;
+        while (tpm->SC & TPM_SC_CMOD_MASK) { }
+        tpm->CNT = 0;
+        tpm->MOD = mod;
+        write_channel_values(t);
+        tpm->SC = TPM_SC_PS(timers[t].prescale) | TPM_SC_CMOD(1);  // edge-aligned, up-counting
+        timers[t].running = true;
+    }
+    timers[t].hz = hz;
+    taskEXIT_CRITICAL();
+    return true;
+}
+
+void PWM_Init(void) {
+    memset(channels, 0, sizeof(channels));
+    memset(timers, 0, sizeof(timers));
+    drivingMask = 0u;
+
+    // All TPMs count MCGPCLK (48 MHz HIRC).
+    SIM->SOPT2 = (SIM->SOPT2 & ~SIM_SOPT2_TPMSRC_MASK) | SIM_SOPT2_TPMSRC(1);
+    timerClockHz = CLOCK_GetFreq(kCLOCK_McgPeriphClk);
+}
+
+PwmHandle_t PWM_Open(const PwmChannelConfig_t *cfg, uint32_t hz) {
+    if (cfg == NULL || cfg->timer >= PWM_TIMER_COUNT ||
+        cfg->channel >= kTimerChannels[cfg->timer] || cfg->minHz > cfg->maxHz) {
+        return PWM_INVALID_HANDLE;
+    }
+
+    PwmTimer_t t = cfg->timer;
+    PwmHandle_t h = PWM_INVALID_HANDLE;
+    if (timers[t].reserved) {
+        return PWM_INVALID_HANDLE;
+    }
+    for (PwmHandle_t i = 0; i < (PwmHandle_t)PWM_MAX_CHANNELS; ++i) {
+        if (channels[i].inUse && channels[i].timer == t && channels[i].channel == cfg->channel) {
+            return PWM_INVALID_HANDLE;   // channel already taken
+        }
+        if (!channels[i].inUse && h == PWM_INVALID_HANDLE) {
+            h = i;
+        }
+    }
+    if (h == PWM_INVALID_HANDLE) {
+        return PWM_INVALID_HANDLE;
+    }
+
+    // Share the running configuration if it suits this output; otherwise the
+    // timer has to move to hz, which every existing user must accept.
+    uint32_t target = hz;
+    if (timers[t].running && timers[t].hz >= cfg->minHz && timers[t].hz <= cfg->maxHz) {
+        target = timers[t].hz;
+    } else if (hz < cfg->minHz || hz > cfg->maxHz || !timer_accepts(t, hz, PWM_INVALID_HANDLE)) {
+        return PWM_INVALID_HANDLE;
+    }
+
+    // The first channel on a timer fixes its prescaler.
+    if (timers[t].users == 0u) {
+        timers[t].prescale = prescale_for(cfg->minHz > 0u ? cfg->minHz : 1u);
+    }
+    uint32_t mod;
+    if (!compute_mod(t, target, &mod)) {
+        return PWM_INVALID_HANDLE;
+    }
+
+    SIM->SCGC6 |= kTimerGates[t];
+    port_clock_enable(cfg->port);
+    cfg->port->PCR[cfg->pin] = (cfg->port->PCR[cfg->pin] & ~PORT_PCR_MUX_MASK) | PORT_PCR_MUX(cfg->mux);
+
+    channels[h].inUse = true;
+    channels[h].timer = t;
+    channels[h].channel = cfg->channel;
+    channels[h].minHz = cfg->minHz;
+    channels[h].maxHz = cfg->maxHz;
+    channels[h].duty = 0;
+    timers[t].users++;
+
+    // Edge-aligned PWM; high-true unless the load is wired active-low.
+    kTimers[t]->CONTROLS[cfg->channel].CnSC =
+        TPM_CnSC_MSB_MASK | (cfg->activeLow ? TPM_CnSC_ELSA_MASK : TPM_CnSC_ELSB_MASK);
+
+    if (!timers[t].running || target != timers[t].hz) {
+        timer_program(t, target);
+    } else {
+        kTimers[t]->CONTROLS[cfg->channel].CnV = 0;
+    }
+    return h;
+}
+
+BaseType_t PWM_SetDuty(PwmHandle_t h, uint16_t duty) {
+    if (!valid_handle(h)) {
+        return pdFAIL;
+    }
+    TPM_Type *tpm = kTimers[channels[h].timer];
+    channels[h].duty = duty;
+    tpm->CONTROLS[channels[h].channel].CnV = duty_to_cnv(duty, tpm->MOD);
+
+    // TPMs stop in VLPS; keep the idle task out of it while anything is lit.
+    taskENTER_CRITICAL();
+    if (duty != 0u) {
+        drivingMask |= (1u << h);
+    } else {
+        drivingMask &= ~(1u << h);
+    }
+    if (drivingMask != 0u) {
+        LowPower_Hold(LOW_POWER_HOLD_PWM);
+    } else {
+        LowPower_Release(LOW_POWER_HOLD_PWM);
+    }
+    taskEXIT_CRITICAL();
+    return pdPASS;
+}
+
+BaseType_t PWM_SetFrequency(PwmHandle_t h, uint32_t hz) {
+    if (!valid_handle(h)) {
+        return pdFAIL;
+    }
+    PwmTimer_t t = channels[h].timer;
+    if (hz == timers[t].hz) {
+        return pdPASS;
+    }
+    if (hz < channels[h].minHz || hz > channels[h].maxHz || !timer_accepts(t, hz, h)) {
+        return pdFAIL;
+    }
+    return timer_program(t, hz) ? pdPASS : pdFAIL;
+}
+
+BaseType_t PWM_SetPulseUs(PwmHandle_t h, uint32_t us) {
+    if (!valid_handle(h)) {
+        return pdFAIL;
+    }
+    uint32_t hz = timers[channels[h].timer].hz;
+    uint64_t duty = ((uint64_t)us * hz * 65536u) / 1000000u;
+    return PWM_SetDuty(h, (uint16_t)(duty > PWM_DUTY_MAX ? PWM_DUTY_MAX : duty));
+}
+
+uint32_t PWM_GetFrequency(PwmHandle_t h) {
+    return valid_handle(h) ? timers[channels[h].timer].hz : 0u;
+}
+
+TPM_Type *PWM_ReserveTimer(PwmTimer_t t) {
+    if (t >= PWM_TIMER_COUNT || timers[t].reserved || timers[t].users != 0u) {
+        return NULL;
+    }
+    timers[t].reserved = true;
+    SIM->SCGC6 |= kTimerGates[t];
+    kTimers[t]->SC = 0;
+    return kTimers[t];
+}
+
+void PWM_ReleaseTimer(PwmTimer_t t) {
+    if (t < PWM_TIMER_COUNT && timers[t].reserved) {
+        kTimers[t]->SC = 0;
+        timers[t].reserved = false;
+        timers[t].running = false;
+    }
+}
+
+uint32_t PWM_GetTimerClockHz(void) {
+    return timerClockHz;
+}
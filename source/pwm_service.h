@@ -0,0 +1,65 @@
+#ifndef PWM_SERVICE_H_
+#define PWM_SERVICE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "fsl_device_registers.h"
+
+#include "FreeRTOS.h"
+
+// Owns TPM0/TPM1/TPM2. Channels on the same TPM share one counter, so they
+// share a frequency: a channel declares the range it tolerates and the
+// service only retunes a timer when every channel on it accepts the new
+// frequency. The first channel opened on a timer fixes its prescaler,
+// sized for that channel's minHz; retuning then only rewrites MOD, and a
+// frequency whose period does not fit 16 bits at that prescaler is
+// refused. Duty and MOD writes go through the TPM's CnV/MOD buffers, so
+// they take effect together at the next period boundary without stopping
+// the counter.
+
+typedef enum {
+    PWM_TPM0 = 0,
+    PWM_TPM1,
+    PWM_TPM2,
+    PWM_TIMER_COUNT
+} PwmTimer_t;
+
+typedef int8_t PwmHandle_t;
+#define PWM_INVALID_HANDLE   ((PwmHandle_t)-1)
+#define PWM_MAX_CHANNELS     8u
+
+#define PWM_DUTY_MAX         0xFFFFu  // 100 %
+#define PWM_DUTY_HALF        0x8000u
+
+typedef struct {
+    PORT_Type *port;     // pin routing, e.g. PORTC / 1 / ALT4 for TPM0_CH0
+    uint8_t pin;
+    uint8_t mux;
+    PwmTimer_t timer;
+    uint8_t channel;
+    uint32_t minHz;      // frequencies this output tolerates; use the same
+    uint32_t maxHz;      // value twice for outputs that need an exact rate
+    bool activeLow;
+} PwmChannelConfig_t;
+
+void PWM_Init(void);
+
+// Allocates a channel. Joins the timer at its current frequency when that
+// suits the new channel; otherwise retunes to hz if all users accept it.
+PwmHandle_t PWM_Open(const PwmChannelConfig_t *cfg, uint32_t hz);
+
+BaseType_t PWM_SetDuty(PwmHandle_t h, uint16_t duty);
+BaseType_t PWM_SetFrequency(PwmHandle_t h, uint32_t hz);
+// High time in microseconds (servo-style outputs).
+BaseType_t PWM_SetPulseUs(PwmHandle_t h, uint32_t us);
+uint32_t PWM_GetFrequency(PwmHandle_t h);
+
+// Hands a whole timer to another driver (DMA pacing, input capture).
+// Fails if the timer already carries PWM channels or another owner.
+TPM_Type *PWM_ReserveTimer(PwmTimer_t timer);
+void PWM_ReleaseTimer(PwmTimer_t timer);
+// Input clock of all TPMs, for drivers that program a reserved timer.
+uint32_t PWM_GetTimerClockHz(void);
+
+#endif /* PWM_SERVICE_H_ */
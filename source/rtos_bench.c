@@ -0,0 +1,379 @@
+/*
+ * @file    rtos_bench.c
+ * @brief   ISR-to-task latency and context-switch benchmark (RTOS_BENCH build)
+ */
+
+#ifdef RTOS_BENCH
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "board.h"
+#include "fsl_debug_console.h"
+#include "fsl_device_registers.h"
+
+#include "fsl_str.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+
+#include "fast_fmt.h"
+#include "pwm_service.h"
+#include "rtos_bench.h"
+#include "rtos_objects.h"
+
+#define BENCH_TPM_INT_PRIO   192u   // same level as ADC0 and UART2
+#define BENCH_BAR_WIDTH      32u
+
+typedef enum {
+    BENCH_ISR_ENTRY = 0,
+    BENCH_SEM,
+    BENCH_NOTIFY,
+    BENCH_QUEUE,
+    BENCH_STREAM,
+    BENCH_MUTEX,
+    BENCH_YIELD,
+    BENCH_FMT_STR,
+    BENCH_FMT_FAST,
+    BENCH_TEST_COUNT
+} BenchTest_t;
+
+typedef enum {
+    PEER_MUTEX = 0,
+    PEER_YIELD
+} PeerCommand_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+    uint16_t buckets[BENCH_BUCKETS + 1u];
+} BenchHist_t;
+
+// Bucket width is 2^shift cycles.
+static const struct {
+    const char *name;
+    uint8_t shift;
+} kTests[BENCH_TEST_COUNT] = {
+    { "isr-entry", 2 },
+    { "sem",       6 },
+    { "notify",    6 },
+    { "queue",     6 },
+    { "stream",    6 },
+    { "mutex",     6 },
+    { "yield",     6 },
+    { "fmt-str",   9 },
+    { "fmt-fast",  9 },
+};
+
+static TPM_Type *benchTimer;
+static BenchHist_t hist[BENCH_TEST_COUNT];
+
+static volatile bool armed;                 // the next overflow is a sample
+static volatile BenchTest_t isrTest;
+static volatile uint16_t giveStamp;         // counter just before the give
+static volatile uint16_t pingStamp;         // counter just before taskYIELD
+static volatile PeerCommand_t peerCommand;
+
+static uint8_t txMessage[UART_BRIDGE_MAX_MSG_LEN];
+static uint8_t rxMessage[UART_BRIDGE_MAX_MSG_LEN];
+
+static inline uint16_t bench_now(void) {
+    return (uint16_t)benchTimer->CNT;
+}
+
+static void record(BenchTest_t t, uint16_t cycles) {
+    BenchHist_t *h = &hist[t];
+    uint32_t b = (uint32_t)cycles >> kTests[t].shift;
+    if (b > BENCH_BUCKETS) {
+        b = BENCH_BUCKETS;
+    }
+    if (h->count == 0u || cycles < h->min) {
+        h->min = cycles;
+    }
+    if (cycles > h->max) {
+        h->max = cycles;
+    }
+    h->sum += cycles;
+    h->count++;
+    h->buckets[b]++;
+}
+
+void Bench_Init(void) {
+    benchTimer = PWM_ReserveTimer(PWM_TPM1);
+    configASSERT(benchTimer != NULL);
+
+    memset(txMessage, 'x', sizeof(txMessage));
+    benchTimer->MOD = 0xFFFFu;
+    benchTimer->CNT = 0;
+    benchTimer->SC = TPM_SC_TOF_MASK | TPM_SC_TOIE_MASK | TPM_SC_CMOD(1);   // no prescaler
+
+    NVIC_SetPriority(TPM1_IRQn, BENCH_TPM_INT_PRIO);
+    NVIC_ClearPendingIRQ(TPM1_IRQn);
+    NVIC_EnableIRQ(TPM1_IRQn);
+}
+
+void TPM1_IRQHandler(void) {
+    // The counter restarted from 0 when TOF was set, so it now holds the
+    // entry latency.
+    uint16_t entry = (uint16_t)TPM1->CNT;
+    TPM1->SC |= TPM_SC_TOF_MASK;
+    if (!armed) {
+        return;
+    }
+    armed = false;
+    record(BENCH_ISR_ENTRY, entry);
+
+    BaseType_t hpw = pdFALSE;
+    giveStamp = bench_now();
+    switch (isrTest) {
+    case BENCH_SEM:
+        xSemaphoreGiveFromISR(RTOS_SEMAPHORE(BenchBinary), &hpw);
+        break;
+    case BENCH_NOTIFY:
+        vTaskNotifyGiveFromISR(RTOS_TASK(BenchWait), &hpw);
+        break;
+    case BENCH_QUEUE:
+        xQueueSendFromISR(RTOS_QUEUE(Bench), txMessage, &hpw);
+        break;
+    case BENCH_STREAM:
+        xStreamBufferSendFromISR(RTOS_STREAM_BUFFER(Bench), txMessage, BENCH_STREAM_BYTES, &hpw);
+        break;
+    default:
+        break;
+    }
+    portYIELD_FROM_ISR(hpw);
+}
+
+/* -------------------- TESTS -------------------- */
+static void run_isr_test(BenchTest_t t) {
+    for (uint32_t i = 0; i < BENCH_SAMPLES; ++i) {
+        isrTest = t;
+        benchTimer->CNT = 0;   // next overflow a full period away: we block first
+        armed = true;
+
+        switch (t) {
+        case BENCH_SEM:
+            (void)xSemaphoreTake(RTOS_SEMAPHORE(BenchBinary), portMAX_DELAY);
+            break;
+        case BENCH_NOTIFY:
+            (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            break;
+        case BENCH_QUEUE:
+            (void)xQueueReceive(RTOS_QUEUE(Bench), rxMessage, portMAX_DELAY);
+            break;
+        case BENCH_STREAM:
+            (void)xStreamBufferReceive(RTOS_STREAM_BUFFER(Bench), rxMessage, BENCH_STREAM_BYTES,
+                                       portMAX_DELAY);
+            break;
+        default:
+            return;
+        }
+        uint16_t wake = bench_now();
+        record(t, (uint16_t)(wake - giveStamp));
+    }
+}
+
+// Peer (lower priority) takes the mutex, we block on it, the peer gives it.
+static void run_mutex_test(void) {
+    SemaphoreHandle_t mutex = RTOS_SEMAPHORE(BenchMutex);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; ++i) {
+        peerCommand = PEER_MUTEX;
+        xTaskNotifyGive(RTOS_TASK(BenchPeer));
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);   // peer holds it now
+        (void)xSemaphoreTake(mutex, portMAX_DELAY);      // peer inherits our priority
+        uint16_t wake = bench_now();
+        record(BENCH_MUTEX, (uint16_t)(wake - giveStamp));
+        xSemaphoreGive(mutex);
+    }
+}
+
+// Run by both tasks at the same priority: every return from taskYIELD
+// measures the switch away from the other task.
+static void pingpong(void) {
+    while (hist[BENCH_YIELD].count < BENCH_SAMPLES) {
+        pingStamp = bench_now();
+        taskYIELD();
+        uint16_t resumed = bench_now();
+        if (hist[BENCH_YIELD].count < BENCH_SAMPLES) {
+            record(BENCH_YIELD, (uint16_t)(resumed - pingStamp));
+        }
+    }
+}
+
+static void run_yield_test(void) {
+    UBaseType_t ownPriority = uxTaskPriorityGet(NULL);
+    UBaseType_t peerPriority = uxTaskPriorityGet(RTOS_TASK(BenchPeer));
+
+    vTaskPrioritySet(RTOS_TASK(BenchPeer), ownPriority);
+    peerCommand = PEER_YIELD;
+    xTaskNotifyGive(RTOS_TASK(BenchPeer));
+    pingpong();
+    vTaskPrioritySet(RTOS_TASK(BenchPeer), peerPriority);
+}
+
+// The formatters on the project's hot-path lines. StrFormatPrintf writes
+// through a buffer callback, as PRINTF and the log rings use it.
+typedef struct {
+    char *buf;
+    uint32_t len;
+} FmtSink_t;
+
+static void fmt_put(char *buf, int32_t *indicator, char val, int len) {
+    FmtSink_t *s = (FmtSink_t *)buf;
+    (void)indicator;
+    for (int i = 0; i < len; ++i) {
+        if (s->len + 1u < BENCH_FMT_BUF) {
+            s->buf[s->len++] = val;
+        }
+    }
+}
+
+static int str_format(char *buf, const char *fmt, ...) {
+    FmtSink_t sink = { buf, 0u };
+    va_list ap;
+    va_start(ap, fmt);
+    (void)StrFormatPrintf(fmt, ap, (char *)&sink, fmt_put);
+    va_end(ap);
+    buf[sink.len] = '\0';
+    return (int)sink.len;
+}
+
+static void run_fmt_test(BenchTest_t t) {
+    static char out[BENCH_FMT_BUF];
+    const char *task = pcTaskGetName(NULL);
+    for (uint32_t i = 0; i < BENCH_SAMPLES; ++i) {
+        uint32_t a = 100u + i * 37u;      // 3-4 digit ADC-like values
+        uint32_t b = 4095u - i;
+        uint16_t start = bench_now();
+        if (t == BENCH_FMT_STR) {
+            switch (i % 3u) {
+            case 0:
+                (void)str_format(out, "water_adc: %u, light_adc: %u\r\n", (unsigned)a, (unsigned)b);
+                break;
+            case 1:
+                (void)str_format(out, "{\"photo\":%lu,\"water\":%lu}\n", (unsigned long)b, (unsigned long)a);
+                break;
+            default:
+                (void)str_format(out, "STAT %s %u%% %lu\n", task, (unsigned)(i % 100u), (unsigned long)(a * 1000u));
+                break;
+            }
+        } else {
+            switch (i % 3u) {
+            case 0:
+                (void)FAST_FMT(out, sizeof(out), FMT_LIT("water_adc: ") FMT_U(a) FMT_LIT(", light_adc: ")
+                               FMT_U(b) FMT_LIT("\r\n"));
+                break;
+            case 1:
+                (void)FAST_FMT(out, sizeof(out), FMT_LIT("{\"photo\":") FMT_U(b) FMT_LIT(",\"water\":")
+                               FMT_U(a) FMT_LIT("}\n"));
+                break;
+            default:
+                (void)FAST_FMT(out, sizeof(out), FMT_LIT("STAT ") FMT_S(task) FMT_C(' ') FMT_U(i % 100u)
+                               FMT_LIT("% ") FMT_U(a * 1000u) FMT_C('\n'));
+                break;
+            }
+        }
+        uint16_t end = bench_now();
+        record(t, (uint16_t)(end - start));
+    }
+}
+
+/* -------------------- REPORT -------------------- */
+static uint32_t percentile(const BenchHist_t *h, uint8_t shift, uint32_t pct) {
+    uint32_t target = (h->count * pct + 99u) / 100u;
+    uint32_t seen = 0;
+    for (uint32_t b = 0; b < BENCH_BUCKETS; ++b) {
+        seen += h->buckets[b];
+        if (seen >= target) {
+            return ((b + 1u) << shift) - 1u;
+        }
+    }
+    return h->max;
+}
+
+static void report(BenchTest_t t) {
+    const BenchHist_t *h = &hist[t];
+    uint8_t shift = kTests[t].shift;
+    if (h->count == 0u) {
+        return;
+    }
+    PRINTF("BENCH %s n=%u min=%u avg=%u max=%u p50<=%u p99<=%u\r\n", kTests[t].name,
+           (unsigned)h->count, (unsigned)h->min, (unsigned)(h->sum / h->count), (unsigned)h->max,
+           (unsigned)percentile(h, shift, 50u), (unsigned)percentile(h, shift, 99u));
+
+    uint16_t peak = 1u;
+    for (uint32_t b = 0; b <= BENCH_BUCKETS; ++b) {
+        if (h->buckets[b] > peak) {
+            peak = h->buckets[b];
+        }
+    }
+    for (uint32_t b = 0; b <= BENCH_BUCKETS; ++b) {
+        if (h->buckets[b] == 0u) {
+            continue;
+        }
+        char bar[BENCH_BAR_WIDTH + 1u];
+        uint32_t len = ((uint32_t)h->buckets[b] * BENCH_BAR_WIDTH + peak - 1u) / peak;
+        memset(bar, '#', len);
+        bar[len] = '\0';
+        PRINTF("  %5u%c | %-32s %u\r\n", (unsigned)(b << shift), (b == BENCH_BUCKETS) ? '+' : ' ',
+               bar, (unsigned)h->buckets[b]);
+    }
+}
+
+/* -------------------- TASKS -------------------- */
+void Bench_WaiterTask(void *pvParameters) {
+    (void)pvParameters;
+    for (;;) {
+        memset(hist, 0, sizeof(hist));
+
+        run_isr_test(BENCH_SEM);
+        run_isr_test(BENCH_NOTIFY);
+        run_isr_test(BENCH_QUEUE);
+        run_isr_test(BENCH_STREAM);
+        run_mutex_test();
+        run_yield_test();
+        run_fmt_test(BENCH_FMT_STR);
+        run_fmt_test(BENCH_FMT_FAST);
+
+        PRINTF("BENCH cycles at %u Hz, queue item %u B, stream send %u B\r\n",
+               (unsigned)PWM_GetTimerClockHz(), (unsigned)UART_BRIDGE_MAX_MSG_LEN,
+               (unsigned)BENCH_STREAM_BYTES);
+        for (uint32_t t = 0; t < BENCH_TEST_COUNT; ++t) {
+            report((BenchTest_t)t);
+        }
+        vTaskDelay(pdMS_TO_TICKS(BENCH_REPEAT_MS));
+    }
+}
+
+void Bench_PeerTask(void *pvParameters) {
+    (void)pvParameters;
+    SemaphoreHandle_t mutex = RTOS_SEMAPHORE(BenchMutex);
+    for (;;) {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (peerCommand == PEER_MUTEX) {
+            (void)xSemaphoreTake(mutex, portMAX_DELAY);
+            xTaskNotifyGive(RTOS_TASK(BenchWait));   // waiter runs and blocks on the mutex
+            giveStamp = bench_now();
+            xSemaphoreGive(mutex);
+        } else {
+            pingpong();
+        }
+    }
+}
+
+// Keeps the CPU busy below the bench tasks, as the application would.
+void Bench_LoadTask(void *pvParameters) {
+    (void)pvParameters;
+    volatile uint32_t spins = 0;
+    for (;;) {
+        spins++;
+    }
+}
+
+#endif /* RTOS_BENCH */
@@ -0,0 +1,41 @@
+#ifndef RTOS_BENCH_H_
+#define RTOS_BENCH_H_
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+// Kernel latency benchmark firmware, built instead of the application when
+// RTOS_BENCH is defined (add it under C/C++ Build > Settings > Preprocessor).
+// rtos_objects.h then creates only the three bench tasks below.
+//
+// TPM1 runs free at the TPM clock (MCGPCLK, 48 MHz = core clock), so every
+// sample is a 16-bit counter difference in core cycles. The overflow
+// interrupt is the stimulus for the ISR tests:
+//   isr-entry    overflow -> first instruction of TPM1_IRQHandler
+//   sem/notify/  FromISR give -> waiting task running again (the ADC0 and
+//   queue/stream UART-RX paths use the binary semaphore and queue forms)
+//   mutex        holder gives -> higher-priority waiter owns it (includes
+//                priority disinheritance)
+//   yield        taskYIELD between two equal-priority tasks
+//   fmt-str/     formatting the sensor, telemetry and STAT lines with
+//   fmt-fast     StrFormatPrintf (into a buffer) and with FAST_FMT
+//                (fast_fmt.h); one of the three lines per sample
+// A busy task at priority 1 keeps the CPU loaded (and the idle task, hence
+// tickless sleep, out of the picture). Results go to the debug console as
+//     BENCH <test> n=<n> min=<cy> avg=<cy> max=<cy> p50<=<cy> p99<=<cy>
+// followed by one histogram line per non-empty bucket.
+
+#define BENCH_SAMPLES        1000u
+#define BENCH_BUCKETS        24u       // plus one overflow bucket
+#define BENCH_REPEAT_MS      20000u
+#define BENCH_STREAM_BYTES   16u       // bytes per stream-buffer send
+#define BENCH_FMT_BUF        48u
+
+void Bench_Init(void);
+
+void Bench_WaiterTask(void *pvParameters);
+void Bench_PeerTask(void *pvParameters);
+void Bench_LoadTask(void *pvParameters);
+
+#endif /* RTOS_BENCH_H_ */
@@ -0,0 +1,140 @@
+/*
+ * @file    rtos_objects.c
+ * @brief   Static buffers and creation code generated from rtos_objects.h
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "timers.h"
+
+#include "actuator_driver.h"
+#include "audio_player.h"
+#include "event_hub.h"
+#include "mutex_profile.h"
+#include "rtos_bench.h"
+#include "rtos_objects.h"
+#include "sensor.h"
+#include "stack_monitor.h"
+#include "trace_recorder.h"
+#include "uart_bridge.h"
+
+/* -------------------- STORAGE -------------------- */
+#define RTOS_TASK_STORAGE(id, name, entry, stack, prio)        \
+    TaskHandle_t xRtosTask_##id;                               \
+    static StackType_t xStack_##id[(stack)];                   \
+    static StaticTask_t xTcb_##id;
+#define RTOS_QUEUE_STORAGE(id, len, size)                      \
+    QueueHandle_t xRtosQueue_##id;                             \
+    static uint8_t ucQueueStorage_##id[(len) * (size)];        \
+    static StaticQueue_t xQueueBuffer_##id;
+#define RTOS_SEMAPHORE_STORAGE(id, kind)                       \
+    SemaphoreHandle_t xRtosSemaphore_##id;                     \
+    static StaticSemaphore_t xSemaphoreBuffer_##id;
+#define RTOS_STREAM_BUFFER_STORAGE(id, size, trigger)          \
+    StreamBufferHandle_t xRtosStreamBuffer_##id;               \
+    static uint8_t ucStreamStorage_##id[(size)];               \
+    static StaticStreamBuffer_t xStreamBuffer_##id;
+#define RTOS_QUEUE_SET_STORAGE(id, len)                        \
+    QueueSetHandle_t xRtosQueueSet_##id;                       \
+    static uint8_t ucQueueSetStorage_##id[(len) * sizeof(QueueSetMemberHandle_t)]; \
+    static StaticQueue_t xQueueSetBuffer_##id;
+#define RTOS_TIMER_STORAGE(id, period, event)                  \
+    TimerHandle_t xRtosTimer_##id;                             \
+    static StaticTimer_t xTimerBuffer_##id;
+
+RTOS_TASK_TABLE(RTOS_TASK_STORAGE)
+RTOS_QUEUE_TABLE(RTOS_QUEUE_STORAGE)
+RTOS_SEMAPHORE_TABLE(RTOS_SEMAPHORE_STORAGE)
+RTOS_STREAM_BUFFER_TABLE(RTOS_STREAM_BUFFER_STORAGE)
+RTOS_QUEUE_SET_TABLE(RTOS_QUEUE_SET_STORAGE)
+RTOS_TIMER_TABLE(RTOS_TIMER_STORAGE)
+
+#define RTOS_TASK_INFO(id, name, entry, stack, prio)  { (name), &xRtosTask_##id, (uint16_t)(stack) },
+const RtosTaskInfo_t kRtosTaskInfo[] = {
+    RTOS_TASK_TABLE(RTOS_TASK_INFO)
+};
+const uint8_t kRtosTaskCount = (uint8_t)(sizeof(kRtosTaskInfo) / sizeof(kRtosTaskInfo[0]));
+
+/* -------------------- CREATION -------------------- */
+#define RTOS_QUEUE_CREATE(id, len, size)                                                     \
+    xRtosQueue_##id = xQueueCreateStatic((len), (size), ucQueueStorage_##id, &xQueueBuffer_##id); \
+    configASSERT(xRtosQueue_##id != NULL);                                                   \
+    TraceRecorder_RegisterObject(xRtosQueue_##id, #id);
+#define RTOS_SEMAPHORE_CREATE(id, kind)                                                      \
+    xRtosSemaphore_##id = xSemaphoreCreate##kind##Static(&xSemaphoreBuffer_##id);            \
+    configASSERT(xRtosSemaphore_##id != NULL);                                               \
+    TraceRecorder_RegisterObject(xRtosSemaphore_##id, #id);                                  \
+    RTOS_SEMAPHORE_PROFILE_##kind(id)
+// Queues and semaphores are named for trace dumps (trace_recorder.h);
+// mutexes are also registered with the contention profiler (mutex_profile.h).
+#define RTOS_SEMAPHORE_PROFILE_Mutex(id)   MutexProfile_Register(xRtosSemaphore_##id, #id);
+#define RTOS_SEMAPHORE_PROFILE_Binary(id)
+#define RTOS_STREAM_BUFFER_CREATE(id, size, trigger)                                         \
+    xRtosStreamBuffer_##id = xStreamBufferCreateStatic((size), (trigger),                    \
+                                                       ucStreamStorage_##id, &xStreamBuffer_##id); \
+    configASSERT(xRtosStreamBuffer_##id != NULL);
+// xQueueCreateSet has no static variant: a set is a queue of member handles.
+#define RTOS_QUEUE_SET_CREATE(id, len)                                                       \
+    xRtosQueueSet_##id = xQueueGenericCreateStatic((len), sizeof(QueueSetMemberHandle_t),    \
+                                                   ucQueueSetStorage_##id, &xQueueSetBuffer_##id, \
+                                                   queueQUEUE_TYPE_SET);                     \
+    configASSERT(xRtosQueueSet_##id != NULL);                                                \
+    TraceRecorder_RegisterObject(xRtosQueueSet_##id, #id);
+#define RTOS_TIMER_CREATE(id, period, event)                                                 \
+    xRtosTimer_##id = xTimerCreateStatic(#id, pdMS_TO_TICKS(period), pdTRUE,                 \
+                                         (void *)(uintptr_t)HUB_EVENT_##event,               \
+                                         EventHub_TimerCallback, &xTimerBuffer_##id);        \
+    configASSERT(xRtosTimer_##id != NULL);
+#define RTOS_TIMER_START(id, period, event)                                                  \
+    (void)xTimerStart(xRtosTimer_##id, 0);
+#define RTOS_TASK_CREATE(id, name, entry, stack, prio)                                       \
+    xRtosTask_##id = xTaskCreateStatic((entry), (name), (stack), NULL, (prio),               \
+                                       xStack_##id, &xTcb_##id);                             \
+    configASSERT(xRtosTask_##id != NULL);
+
+void RtosObjects_Init(void)
+{
+    RTOS_QUEUE_TABLE(RTOS_QUEUE_CREATE)
+    RTOS_SEMAPHORE_TABLE(RTOS_SEMAPHORE_CREATE)
+    RTOS_STREAM_BUFFER_TABLE(RTOS_STREAM_BUFFER_CREATE)
+    RTOS_QUEUE_SET_TABLE(RTOS_QUEUE_SET_CREATE)
+    RTOS_TIMER_TABLE(RTOS_TIMER_CREATE)
+}
+
+void RtosObjects_StartTasks(void)
+{
+    RTOS_TASK_TABLE(RTOS_TASK_CREATE)
+    // Queued to the timer service task; they run once the scheduler starts.
+    RTOS_TIMER_TABLE(RTOS_TIMER_START)
+}
+
+/* -------------------- KERNEL TASKS -------------------- */
+// Idle and timer-service task memory, required with static allocation.
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer,
+                                   StackType_t **ppxIdleTaskStackBuffer,
+                                   configSTACK_DEPTH_TYPE *puxIdleTaskStackSize)
+{
+    static StaticTask_t xIdleTcb;
+    static StackType_t xIdleStack[configMINIMAL_STACK_SIZE];
+
+    *ppxIdleTaskTCBBuffer = &xIdleTcb;
+    *ppxIdleTaskStackBuffer = xIdleStack;
+    *puxIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+#if (configUSE_TIMERS == 1)
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer,
+                                    StackType_t **ppxTimerTaskStackBuffer,
+                                    configSTACK_DEPTH_TYPE *puxTimerTaskStackSize)
+{
+    static StaticTask_t xTimerTcb;
+    static StackType_t xTimerStack[configTIMER_TASK_STACK_DEPTH];
+
+    *ppxTimerTaskTCBBuffer = &xTimerTcb;
+    *ppxTimerTaskStackBuffer = xTimerStack;
+    *puxTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
@@ -0,0 +1,144 @@
+#ifndef RTOS_OBJECTS_H_
+#define RTOS_OBJECTS_H_
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "timers.h"
+
+#include "dht11.h"
+#include "event_hub.h"
+#include "log_console.h"
+#include "stack_monitor.h"
+#include "uart_bridge.h"
+
+// Every task, queue, semaphore and timer in the firmware, allocated statically.
+// The tables below expand into the stack/TCB/storage buffers, the handles
+// and the creation code in rtos_objects.c, so all kernel RAM shows up as
+// named symbols in GP.map (no heap). Add an object here, not with
+// xTaskCreate/xQueueCreate in a module.
+
+// The asynchronous console's drain task (log_console.h), lowest priority.
+#if (DEBUG_CONSOLE_ASYNC_LOG > 0U)
+#define RTOS_LOG_TASKS(X) \
+    X(LogDrain,    "LogDrain",     LogConsole_DrainTask,     configMINIMAL_STACK_SIZE + 64,  1)
+#else
+#define RTOS_LOG_TASKS(X)
+#endif
+
+// The on-chip DHT11 reader (dht11.h); without it the ESP32 supplies readings.
+#if (DHT11_LOCAL_ENABLE > 0)
+#define RTOS_DHT_TASKS(X) \
+    X(Dht11,       "Dht11",        Dht11_Task,               configMINIMAL_STACK_SIZE + 96,  2)
+#else
+#define RTOS_DHT_TASKS(X)
+#endif
+
+// X(id, name, entry, stackWords, priority)
+#ifdef RTOS_BENCH
+// Benchmark build (rtos_bench.h): the bench tasks replace the application's;
+// the application's queues and semaphores are still created (unused), its
+// timers are not.
+#define RTOS_TASK_TABLE(X)                                                            \
+    X(BenchWait,   "BenchWait",    Bench_WaiterTask,         configMINIMAL_STACK_SIZE + 192, 4) \
+    X(BenchPeer,   "BenchPeer",    Bench_PeerTask,           configMINIMAL_STACK_SIZE + 64,  3) \
+    X(BenchLoad,   "BenchLoad",    Bench_LoadTask,           configMINIMAL_STACK_SIZE,       1)
+#define RTOS_BENCH_QUEUES(X)          X(Bench, 1, UART_BRIDGE_MAX_MSG_LEN)
+#define RTOS_BENCH_SEMAPHORES(X)      X(BenchBinary, Binary) X(BenchMutex, Mutex)
+#define RTOS_BENCH_STREAM_BUFFERS(X)  X(Bench, 64, 1)
+#define RTOS_APP_TIMERS(X)
+#else
+#define RTOS_TASK_TABLE(X)                                                            \
+    X(Sensor,      "SensorTask",   Sensor_Task,              configMINIMAL_STACK_SIZE + 256, 2) \
+    X(ActuatorOut, "ActuatorOut",  Actuator_Output_Task,     configMINIMAL_STACK_SIZE + 128, 1) \
+    X(Audio,       "Audio",        Audio_Task,               configMINIMAL_STACK_SIZE + 64,  1) \
+    X(Hub,         "Hub",          EventHub_Task,            configMINIMAL_STACK_SIZE + 320, 3) \
+    X(Stats,       "Stats",        UART_Bridge_StatsTask,    configMINIMAL_STACK_SIZE + 320, 1) \
+    RTOS_DHT_TASKS(X)                                                                 \
+    RTOS_LOG_TASKS(X)
+#define RTOS_BENCH_QUEUES(X)
+#define RTOS_BENCH_SEMAPHORES(X)
+#define RTOS_BENCH_STREAM_BUFFERS(X)
+// Periodic hub events; each timer posts its event (EventHub_TimerCallback).
+#define RTOS_APP_TIMERS(X)                                  \
+    X(DhtPoll,     2000u,                   DHT_POLL)       \
+    X(PlantLogic,  2000u,                   PLANT_LOGIC)    \
+    X(StackReport, STACK_MONITOR_PERIOD_MS, STACK_REPORT)
+#endif
+
+// X(id, length, itemSize)
+#define RTOS_QUEUE_TABLE(X)                                  \
+    X(UartRx, 5, UART_BRIDGE_MAX_MSG_LEN)                    \
+    RTOS_BENCH_QUEUES(X)
+
+// X(id, kind) -- kind is Mutex or Binary
+#define RTOS_SEMAPHORE_TABLE(X)   \
+    X(SensorData,      Mutex)     \
+    X(WaterLevel,      Binary)    \
+    X(ActuatorPending, Binary)    \
+    X(UartTx,          Mutex)     \
+    X(HubDoorbell,     Binary)    \
+    X(StatsRequest,    Binary)    \
+    RTOS_BENCH_SEMAPHORES(X)
+
+// X(id, sizeBytes, triggerLevelBytes)
+// UartTx: bridge lines waiting for the UART2 TX interrupt (uart_bridge.h).
+#define RTOS_STREAM_BUFFER_TABLE(X) \
+    X(UartTx, 256, 1)               \
+    RTOS_BENCH_STREAM_BUFFERS(X)
+
+// X(id, length) -- length: total item slots of all member queues/semaphores.
+// Hub holds every UartRx slot plus the doorbell (event_hub.h).
+#define RTOS_QUEUE_SET_TABLE(X) \
+    X(Hub, 5 + 1)
+
+// X(id, periodMs, event) -- auto-reload, started with the tasks
+#define RTOS_TIMER_TABLE(X) \
+    RTOS_APP_TIMERS(X)
+
+#define RTOS_TASK(id)        (xRtosTask_##id)
+#define RTOS_QUEUE(id)       (xRtosQueue_##id)
+#define RTOS_SEMAPHORE(id)   (xRtosSemaphore_##id)
+#define RTOS_STREAM_BUFFER(id) (xRtosStreamBuffer_##id)
+#define RTOS_QUEUE_SET(id)   (xRtosQueueSet_##id)
+#define RTOS_TIMER(id)       (xRtosTimer_##id)
+
+#define RTOS_DECLARE_TASK(id, name, entry, stack, prio)  extern TaskHandle_t xRtosTask_##id;
+#define RTOS_DECLARE_QUEUE(id, len, size)                extern QueueHandle_t xRtosQueue_##id;
+#define RTOS_DECLARE_SEMAPHORE(id, kind)                 extern SemaphoreHandle_t xRtosSemaphore_##id;
+#define RTOS_DECLARE_STREAM_BUFFER(id, size, trigger)    extern StreamBufferHandle_t xRtosStreamBuffer_##id;
+#define RTOS_DECLARE_QUEUE_SET(id, len)                  extern QueueSetHandle_t xRtosQueueSet_##id;
+#define RTOS_DECLARE_TIMER(id, period, event)            extern TimerHandle_t xRtosTimer_##id;
+RTOS_TASK_TABLE(RTOS_DECLARE_TASK)
+RTOS_QUEUE_TABLE(RTOS_DECLARE_QUEUE)
+RTOS_SEMAPHORE_TABLE(RTOS_DECLARE_SEMAPHORE)
+RTOS_STREAM_BUFFER_TABLE(RTOS_DECLARE_STREAM_BUFFER)
+RTOS_QUEUE_SET_TABLE(RTOS_DECLARE_QUEUE_SET)
+RTOS_TIMER_TABLE(RTOS_DECLARE_TIMER)
+#undef RTOS_DECLARE_TASK
+#undef RTOS_DECLARE_QUEUE
+#undef RTOS_DECLARE_SEMAPHORE
+#undef RTOS_DECLARE_STREAM_BUFFER
+#undef RTOS_DECLARE_QUEUE_SET
+#undef RTOS_DECLARE_TIMER
+
+// Name, handle and stack size of every task in RTOS_TASK_TABLE (table order),
+// for monitors that walk all application tasks.
+typedef struct {
+    const char *name;
+    TaskHandle_t *handle;
+    uint16_t stackWords;
+} RtosTaskInfo_t;
+
+extern const RtosTaskInfo_t kRtosTaskInfo[];
+extern const uint8_t kRtosTaskCount;
+
+// Queues, semaphores, stream buffers, queue sets and timers; call before the module Init functions use them.
+void RtosObjects_Init(void);
+// Tasks, and starts the timers; call once the modules are initialised,
+// right before the scheduler.
+void RtosObjects_StartTasks(void);
+
+#endif /* RTOS_OBJECTS_H_ */
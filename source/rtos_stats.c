@@ -0,0 +1,82 @@
+/*
+ * @file    rtos_stats.c
+ * @brief   Windowed per-task CPU usage from FreeRTOS run-time stats
+ */
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "fast_fmt.h"
+#include "rtos_stats.h"
+
+#ifndef configIDLE_TASK_NAME
+#define configIDLE_TASK_NAME "IDLE"   // kernel default (tasks.c)
+#endif
+
+static TaskStatus_t status[RTOS_STATS_MAX_TASKS];
+static uint32_t prevRunTime[RTOS_STATS_MAX_TASKS + 1u];   // indexed by xTaskNumber
+static uint32_t prevTotal;
+
+static RtosTaskStat_t window[RTOS_STATS_MAX_TASKS];
+static uint8_t windowCount;
+
+void RtosStats_Sample(void) {
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    UBaseType_t n = uxTaskGetSystemState(status, RTOS_STATS_MAX_TASKS, &total);
+    uint32_t elapsed = (uint32_t)total - prevTotal;
+    RtosTaskStat_t fresh[RTOS_STATS_MAX_TASKS];
+
+    for (UBaseType_t i = 0; i < n; ++i) {
+        UBaseType_t num = status[i].xTaskNumber;
+        uint32_t now = (uint32_t)status[i].ulRunTimeCounter;
+        uint32_t delta = now;
+        if (num <= RTOS_STATS_MAX_TASKS) {
+            delta = now - prevRunTime[num];
+            prevRunTime[num] = now;
+        }
+        fresh[i].name = status[i].pcTaskName;
+        fresh[i].runTimeTicks = now;
+        fresh[i].cpuPercent = elapsed ? (uint8_t)(((uint64_t)delta * 100u) / elapsed) : 0u;
+    }
+    prevTotal = (uint32_t)total;
+
+    taskENTER_CRITICAL();
+    memcpy(window, fresh, n * sizeof(fresh[0]));
+    windowCount = (uint8_t)n;
+    taskEXIT_CRITICAL();
+}
+
+uint8_t RtosStats_Get(RtosTaskStat_t *out, uint8_t max) {
+    if (out == NULL) {
+        return 0u;
+    }
+    taskENTER_CRITICAL();
+    uint8_t n = windowCount < max ? windowCount : max;
+    memcpy(out, window, n * sizeof(window[0]));
+    taskEXIT_CRITICAL();
+    return n;
+}
+
+BaseType_t RtosStats_FormatFrame(char *buf, size_t len) {
+    RtosTaskStat_t stats[RTOS_STATS_MAX_TASKS];
+    uint8_t n = RtosStats_Get(stats, RTOS_STATS_MAX_TASKS);
+    unsigned idle = 0u;
+    const RtosTaskStat_t *top = NULL;
+
+    for (uint8_t i = 0; i < n; ++i) {
+        if (strcmp(stats[i].name, configIDLE_TASK_NAME) == 0) {
+            idle = stats[i].cpuPercent;
+        } else if (top == NULL || stats[i].cpuPercent > top->cpuPercent) {
+            top = &stats[i];
+        }
+    }
+    if (top == NULL) {
+        return pdFAIL;
+    }
+
+    int written = FAST_FMT(buf, len, FMT_LIT("{\"idle\":") FMT_U(idle) FMT_LIT(",\"top\":\"")
+                           FMT_S(top->name) FMT_LIT("\",\"load\":") FMT_U(top->cpuPercent) FMT_LIT("}\n"));
+    return (written > 0) ? pdPASS : pdFAIL;
+}
@@ -0,0 +1,31 @@
+#ifndef RTOS_STATS_H_
+#define RTOS_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+// Per-task CPU share over the last sampling window, from the kernel's
+// run-time counters (runtime_clock.h). Sampling is done by one task
+// (the hub's DHT poll handler); readers get a copy of the last completed window.
+
+#define RTOS_STATS_MAX_TASKS       10u
+#define RTOS_STATS_PERIOD_MS       10000u
+
+typedef struct {
+    const char *name;        // points at the task's own name (tasks are never deleted)
+    uint8_t cpuPercent;      // share of the last window
+    uint32_t runTimeTicks;   // total since boot, RUNTIME_CLOCK_HZ ticks
+} RtosTaskStat_t;
+
+void RtosStats_Sample(void);
+
+// Copies up to max entries of the last window; returns the number copied.
+uint8_t RtosStats_Get(RtosTaskStat_t *out, uint8_t max);
+
+// One-line summary for the ESP32 display:
+// {"idle":<pct>,"top":"<busiest task>","load":<pct>}\n
+BaseType_t RtosStats_FormatFrame(char *buf, size_t len);
+
+#endif /* RTOS_STATS_H_ */
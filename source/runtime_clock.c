@@ -0,0 +1,58 @@
+/*
+ * @file    runtime_clock.c
+ * @brief   PIT0/PIT1 chained lifetime timer
+ */
+
+#include "board.h"
+#include "fsl_common.h"
+#include "fsl_clock.h"
+#include "fsl_device_registers.h"
+
+#include "FreeRTOS.h"
+
+#include "runtime_clock.h"
+
+static uint32_t cyclesPerTick;
+
+void RuntimeClock_Init(void) {
+    if (cyclesPerTick != 0u) {
+        return;   // already running (kernel and app may both ask)
+    }
+    cyclesPerTick = CLOCK_GetBusClkFreq() / RUNTIME_CLOCK_HZ;
+
+    SIM->SCGC6 |= SIM_SCGC6_PIT_MASK;
+    PIT->MCR = PIT_MCR_FRZ_MASK;                      // module on, frozen in debug halt
+
+    PIT->CHANNEL[0].TCTRL = 0;
+    PIT->CHANNEL[1].TCTRL = 0;
+    PIT->CHANNEL[1].LDVAL = 0xFFFFFFFFu;
+    PIT->CHANNEL[1].TCTRL = PIT_TCTRL_CHN_MASK | PIT_TCTRL_TEN_MASK;  // counts PIT0 expiries
+    PIT->CHANNEL[0].LDVAL = cyclesPerTick - 1u;
+    PIT->CHANNEL[0].TCTRL = PIT_TCTRL_TEN_MASK;       // no interrupt
+}
+
+uint32_t RuntimeClock_Ticks(void) {
+    return ~PIT->CHANNEL[1].CVAL;   // down-counter from 0xFFFFFFFF
+}
+
+uint64_t RuntimeClock_Cycles(void) {
+    // Reading LTMR64H latches PIT0 into LTMR64L, so the pair is coherent.
+    uint32_t hi = PIT->LTMR64H;
+    uint32_t lo = PIT->LTMR64L;
+    return (uint64_t)(~hi) * cyclesPerTick + ((cyclesPerTick - 1u) - lo);
+}
+
+uint32_t RuntimeClock_Cycles32(void) {
+    uint32_t hi = PIT->LTMR64H;
+    uint32_t lo = PIT->LTMR64L;
+    return (~hi) * cyclesPerTick + ((cyclesPerTick - 1u) - lo);
+}
+
+uint32_t RuntimeClock_CyclesPerTick(void) {
+    return cyclesPerTick;
+}
+
+uint32_t RuntimeClock_CyclesToUs(uint64_t cycles) {
+    uint32_t perUs = (cyclesPerTick * RUNTIME_CLOCK_HZ) / 1000000u;
+    return (uint32_t)(cycles / (perUs != 0u ? perUs : 1u));
+}
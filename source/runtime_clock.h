@@ -0,0 +1,28 @@
+#ifndef RUNTIME_CLOCK_H_
+#define RUNTIME_CLOCK_H_
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+// Free-running time base on PIT0 chained into PIT1 (the PIT lifetime timer).
+// PIT0 divides the bus clock down to RUNTIME_CLOCK_HZ, PIT1 counts those
+// periods; no interrupts are involved. Used as the FreeRTOS run-time stats
+// counter and for fine-grained timestamps.
+
+#define RUNTIME_CLOCK_HZ   (10u * configTICK_RATE_HZ)
+
+void RuntimeClock_Init(void);
+
+// RUNTIME_CLOCK_HZ ticks since init (wraps after ~24 days at 2 kHz).
+uint32_t RuntimeClock_Ticks(void);
+// Bus clock cycles since init, read atomically from LTMR64H/LTMR64L.
+uint64_t RuntimeClock_Cycles(void);
+// Low 32 bits of RuntimeClock_Cycles without 64-bit arithmetic, for hot
+// paths (wraps every ~179 s at 24 MHz).
+uint32_t RuntimeClock_Cycles32(void);
+uint32_t RuntimeClock_CyclesPerTick(void);
+// Converts a difference of RuntimeClock_Cycles values.
+uint32_t RuntimeClock_CyclesToUs(uint64_t cycles);
+
+#endif /* RUNTIME_CLOCK_H_ */
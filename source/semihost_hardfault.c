@@ -48,6 +48,9 @@
 // Allow handler to be removed by setting a define (via command line)
 #if !defined (__SEMIHOST_HARDFAULT_DISABLE)
 
+// configUSE_TRACE_RECORDER
+#include "FreeRTOSConfig.h"
+
 __attribute__((naked))
 void HardFault_Handler(void){
     __asm(  ".syntax unified\n"
@@ -68,8 +71,14 @@ void HardFault_Handler(void){
             "LDR    R3,=0xBEAB       \n"
             "CMP    R2,R3            \n"
             "BEQ    _semihost_return \n"
+#if (configUSE_TRACE_RECORDER == 1)
+        // Wasn't semihosting instruction: dump the kernel trace, R0 = frame
+            "LDR    R3,=TraceRecorder_HardFault \n"
+            "BX     R3               \n"
+#else
         // Wasn't semihosting instruction so enter infinite loop
             "B .                     \n"
+#endif
         // Was semihosting instruction, so adjust location to
         // return to by 1 instruction (2 bytes), then exit function
             "_semihost_return:       \n"
@@ -14,17 +14,20 @@
 #include "semphr.h"
 
 #include "actuator_driver.h"
+#include "actuator_mailbox.h"
+#include "deadline_monitor.h"
+#include "event_hub.h"
+#include "log.h"
+#include "mutex_profile.h"
+#include "plant_rules.h"
+#include "rtos_objects.h"
 #include "sensor.h"
+#include "trace_recorder.h"
 #include "uart_bridge.h"
 
 #define WATER_LEVEL_PIN       0u  // PTC0 -> ADC0_SE14
 #define PHOTORESISTOR_PIN     20u // PTE20 -> ADC0_SE0
 
-static const uint32_t kWaterLevelWetThreshold    = 1800u;
-static const uint32_t kPhotoresistorBrightLimit  = 5u;
-static const uint32_t kDHT11TemperatureThreshold = 40;
-static const uint32_t kDHT11HumidityThreshold = 50;
-
 static SemaphoreHandle_t xWaterLevelSemaphore;
 static SemaphoreHandle_t xSensorDataMutex;
 static SensorData_t *gSensorData;
@@ -93,7 +96,7 @@ void Sensors_Init(SensorData_t *sharedData, SemaphoreHandle_t dataMutex) {
         memset(gSensorData, 0, sizeof(*gSensorData));
     }
 
-    xWaterLevelSemaphore = xSemaphoreCreateBinary();
+    xWaterLevelSemaphore = RTOS_SEMAPHORE(WaterLevel);
     configASSERT(xWaterLevelSemaphore != NULL);
 
     gLatestWaterLevel = 0u;
@@ -101,6 +104,7 @@ void Sensors_Init(SensorData_t *sharedData, SemaphoreHandle_t dataMutex) {
 }
 
  void ADC0_IRQHandler(void) {
+     TraceRecorder_IsrEnter();
      NVIC_ClearPendingIRQ(ADC0_IRQn);
      BaseType_t hpw = pdFALSE;
 
@@ -109,10 +113,13 @@ void Sensors_Init(SensorData_t *sharedData, SemaphoreHandle_t dataMutex) {
          gLatestWaterLevel = adcValue;
 
          xSemaphoreGiveFromISR(xWaterLevelSemaphore, &hpw);
+         TraceRecorder_IsrExit();
          portYIELD_FROM_ISR(hpw);
 // restart conversion on channel 14 (PTC0)
          //ADC0->SC1[0] = ADC_SC1_AIEN_MASK | ADC_SC1_ADCH(14);
+         return;
      }
+     TraceRecorder_IsrExit();
  }
 /*
 void Sensor_Task(void *pvParameters) {
@@ -133,7 +140,7 @@ void Sensor_Task(void *pvParameters) {
  }*/
  void Sensor_Task(void *pvParameters) {
      (void)pvParameters;
-     TickType_t lastTelemetryTick = xTaskGetTickCount();
+     DeadlineMonitor_Start(DEADLINE_Sensor);
      for (;;) {
          // 1) Start water (PTC0 = ADC0_SE14) with interrupt enabled
          while (ADC0->SC2 & ADC_SC2_ADACT_MASK) { }
@@ -147,32 +154,22 @@ void Sensor_Task(void *pvParameters) {
          uint32_t waterRaw = gLatestWaterLevel;
 
          if (gSensorData && xSensorDataMutex) {
-             if (xSemaphoreTake(xSensorDataMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+             if (MutexProfile_Take(xSensorDataMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
                  gSensorData->water_level = waterRaw;
                  gSensorData->light_intensity = lightRaw;
-                 xSemaphoreGive(xSensorDataMutex);
+                 MutexProfile_Give(xSensorDataMutex);
              }
          }
 
          // 4) Print actual values
-         PRINTF("water_adc: %u, light_adc: %u\r\n",
-                (unsigned)waterRaw,
-                (unsigned)lightRaw);
+         LOG_DEBUG(SENSOR, "water_adc: %u, light_adc: %u\r\n",
+                   (unsigned)waterRaw,
+                   (unsigned)lightRaw);
 
-         if (gSensorData && xSensorDataMutex) {
-             TickType_t now = xTaskGetTickCount();
-             if ((now - lastTelemetryTick) >= pdMS_TO_TICKS(2000)) {
-                 SensorData_t snapshot;
-                 if (xSemaphoreTake(xSensorDataMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-                     snapshot = *gSensorData;
-                     xSemaphoreGive(xSensorDataMutex);
-                     UART_Bridge_SendSensorTelemetry(&snapshot);
-                 }
-                 lastTelemetryTick = now;
-             }
-         }
+         // Telemetry and the logic run in the hub, off this task.
+         EventHub_Post(HUB_EVENT_SENSOR);
 
-         vTaskDelay(pdMS_TO_TICKS(200)); // ~5 Hz
+         DeadlineMonitor_WaitNext(DEADLINE_Sensor); // 5 Hz, see deadline_monitor.h
      }
  }
 
@@ -193,39 +190,58 @@ void Actuator_Task() {
   }
 }*/
 
-void Actuator_Task(void *pvParameters) {
-    (void)pvParameters;
-    SensorData_t dataSnapshot = {0};
-    while (1) {
+// Last values handed to the mailbox; work is only posted when they change.
+static SensorData_t dataSnapshot;
+static PlantDecision_t lastDecision = { PLANT_ACTION_COUNT, 0u };
+static int32_t lastPwm = -1;
 
-        if (gSensorData && xSensorDataMutex) {
-            if (xSemaphoreTake(xSensorDataMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-                dataSnapshot = *gSensorData;
-                xSemaphoreGive(xSensorDataMutex);
-            }
-        }
+// PLANT_LOGIC hub handler, every 2 s (RTOS_TIMER_TABLE)
+void Actuator_OnLogicTimer(HubEvent_t event, const void *payload) {
+    (void)event;
+    (void)payload;
 
-        // Map 0..4095 ADC to 0..255 PWM
-        uint32_t pwmValue = (dataSnapshot.light_intensity * 255u) / 4095u;
-        uint8_t pwm = 0;
-        if (dataSnapshot.light_intensity <= 5) pwm = 0;
-        else if (dataSnapshot.light_intensity >= 30) pwm = 255;
-        else pwm = (dataSnapshot.light_intensity - 5) * 255 / (30 - 5);
+    if (gSensorData && xSensorDataMutex) {
+        if (MutexProfile_Take(xSensorDataMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+            dataSnapshot = *gSensorData;
+            MutexProfile_Give(xSensorDataMutex);
+        }
+    }
 
-        Set_LED_Intensity(pwm);
+    // Map 0..4095 ADC to 0..255 PWM
+    uint8_t pwm = 0;
+    if (dataSnapshot.light_intensity <= 5) pwm = 0;
+    else if (dataSnapshot.light_intensity >= 30) pwm = 255;
+    else pwm = (dataSnapshot.light_intensity - 5) * 255 / (30 - 5);
 
-        bool water_is_wet   = (dataSnapshot.water_level    >= kWaterLevelWetThreshold);
-        bool light_is_bright= (dataSnapshot.light_intensity <= kPhotoresistorBrightLimit);
-        bool temperature_is_high = (dataSnapshot.temperature <= kDHT11TemperatureThreshold);
-        bool humidity_is_high = (dataSnapshot.humidity <= kDHT11HumidityThreshold);
+    if ((int32_t)pwm != lastPwm) {
+        ActuatorCommand_t ledCmd = { ACTUATOR_LED, pwm, 0u };
+        ActuatorMailbox_Post(&ledCmd);
+        lastPwm = pwm;
+    }
 
-        if (water_is_wet && light_is_bright && temperature_is_high && humidity_is_high) {
-            Play_Music(MUSIC_HAPPY);
-        } else {
-            Play_Music(MUSIC_SAD);
+    // Thresholds, hysteresis and the condition -> action mapping live in
+    // plant_rules. The tune plays once when the plant changes state
+    // instead of being replayed on every pass.
+    PlantDecision_t decision;
+    PlantRules_Evaluate(&dataSnapshot, &decision);
+
+    if (decision.action != lastDecision.action || decision.priority != lastDecision.priority) {
+        ActuatorCommand_t musicCmd = { ACTUATOR_BUZZER_MUSIC_STRESSED, 0u, 0u };
+        bool haveMusic = true;
+        switch ((PlantAction_t)decision.action) {
+        case PLANT_ACTION_HAPPY:    musicCmd.type = ACTUATOR_BUZZER_MUSIC_HAPPY; break;
+        case PLANT_ACTION_STRESSED: musicCmd.type = ACTUATOR_BUZZER_MUSIC_STRESSED; break;
+        case PLANT_ACTION_ALERT:    musicCmd.type = ACTUATOR_BUZZER_ALERT; break;
+        default:                    haveMusic = false; break;
         }
-
-        vTaskDelay(pdMS_TO_TICKS(2000));
+        if (haveMusic) {
+            if (decision.priority >= PLANT_PRIORITY_ALERT) {
+                ActuatorMailbox_PostAlert(&musicCmd);
+            } else {
+                ActuatorMailbox_Post(&musicCmd);
+            }
+        }
+        lastDecision = decision;
     }
 }
 
@@ -235,9 +251,9 @@ void Sensor_UpdateRemoteReadings(float temperature, float humidity) {
         return;
     }
 
-    if (xSemaphoreTake(xSensorDataMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+    if (MutexProfile_Take(xSensorDataMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
         gSensorData->temperature = temperature;
         gSensorData->humidity = humidity;
-        xSemaphoreGive(xSensorDataMutex);
+        MutexProfile_Give(xSensorDataMutex);
     }
 }
@@ -6,6 +6,8 @@
 #include "FreeRTOS.h"
 #include "semphr.h"
 
+#include "event_hub.h"
+
 typedef struct {
     uint32_t water_level;
     uint32_t light_intensity;
@@ -15,7 +17,8 @@ typedef struct {
 
 void Sensors_Init(SensorData_t *sharedData, SemaphoreHandle_t dataMutex);
 void Sensor_Task(void *pvParameters);
-void Actuator_Task(void *pvParameters);
+// PLANT_LOGIC hub handler: LED level and rule evaluation
+void Actuator_OnLogicTimer(HubEvent_t event, const void *payload);
 void Sensor_UpdateRemoteReadings(float temperature, float humidity);
 
 #endif /* SENSOR_H_ */
@@ -0,0 +1,53 @@
+/*
+ * @file    stack_monitor.c
+ * @brief   Periodic stack high-water-mark report and overflow hook
+ */
+
+#include "board.h"
+#include "fsl_debug_console.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include "rtos_objects.h"
+#include "stack_monitor.h"
+#include "trace_recorder.h"
+
+static void report(const char *name, TaskHandle_t handle, uint32_t sizeWords) {
+    if (handle == NULL) {
+        return;
+    }
+    uint32_t freeWords = (uint32_t)uxTaskGetStackHighWaterMark(handle);
+    PRINTF("STACK %s %u %u%s\r\n", name, (unsigned)sizeWords, (unsigned)freeWords,
+           freeWords < STACK_MONITOR_WARN_WORDS ? " LOW" : "");
+}
+
+void StackMonitor_OnTimer(HubEvent_t event, const void *payload) {
+    (void)event;
+    (void)payload;
+
+    for (uint8_t i = 0; i < kRtosTaskCount; ++i) {
+        report(kRtosTaskInfo[i].name, *kRtosTaskInfo[i].handle, kRtosTaskInfo[i].stackWords);
+    }
+    // Kernel tasks, sized in rtos_objects.c
+    report("IDLE", xTaskGetIdleTaskHandle(), configMINIMAL_STACK_SIZE);
+#if (configUSE_TIMERS == 1)
+    report("Tmr Svc", xTimerGetTimerDaemonTaskHandle(), configTIMER_TASK_STACK_DEPTH);
+#endif
+}
+
+#if (configCHECK_FOR_STACK_OVERFLOW > 0)
+// Name of the task whose stack pattern was found overwritten (for the debugger).
+volatile const char *gStackOverflowTask;
+
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName) {
+    (void)xTask;
+    gStackOverflowTask = pcTaskName;
+    // Memory next to the stack is already corrupt: stop here.
+    taskDISABLE_INTERRUPTS();
+    TRACE_RECORDER_FAULT("stack");
+    for (;;) {
+    }
+}
+#endif
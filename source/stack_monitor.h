@@ -0,0 +1,22 @@
+#ifndef STACK_MONITOR_H_
+#define STACK_MONITOR_H_
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+
+#include "event_hub.h"
+
+// Samples the stack high-water mark of every task and prints one line per
+// task to the debug console:
+//     STACK <name> <size-words> <min-free-words>
+// tools/stack_report.py combines a captured log with the -fstack-usage
+// (.su) files to recommend stack sizes for rtos_objects.h.
+
+#define STACK_MONITOR_PERIOD_MS    30000u
+#define STACK_MONITOR_WARN_WORDS   16u     // flag tasks with less headroom
+
+// STACK_REPORT hub handler, every STACK_MONITOR_PERIOD_MS (RTOS_TIMER_TABLE)
+void StackMonitor_OnTimer(HubEvent_t event, const void *payload);
+
+#endif /* STACK_MONITOR_H_ */
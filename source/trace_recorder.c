@@ -0,0 +1,200 @@
+/*
+ * @file    trace_recorder.c
+ * @brief   Kernel event ring buffer with console and fault-time dump
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "fsl_debug_console.h"
+#include "fsl_device_registers.h"
+#include "fsl_lpuart.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+
+#if (configUSE_TRACE_RECORDER == 1)
+
+#include "log_console.h"
+#include "rtos_objects.h"
+#include "runtime_clock.h"
+#include "trace_recorder.h"
+
+_Static_assert((TRACE_RECORDER_RECORDS & (TRACE_RECORDER_RECORDS - 1u)) == 0u,
+               "TRACE_RECORDER_RECORDS must be a power of two");
+_Static_assert(sizeof(TraceRecord_t) == 8u, "records are 8 bytes");
+
+#define RECORDS_PER_LINE  4u
+
+static TraceRecord_t ring[TRACE_RECORDER_RECORDS];
+static uint32_t head;                 // records written since the last restart
+static volatile bool recording;
+static const char *objectNames[TRACE_RECORDER_MAX_OBJECTS];
+static uint8_t objectCount;
+
+typedef void (*TraceEmit_t)(const char *line);
+
+/* -------------------- RECORDING -------------------- */
+// Called from the kernel with the scheduler locked or interrupts masked,
+// and from ISRs; the mask makes the slot claim and the write one step.
+void TraceRecorder_Record(uint8_t type, uint8_t arg, uint16_t value) {
+    UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+    if (recording) {
+        TraceRecord_t *r = &ring[head & (TRACE_RECORDER_RECORDS - 1u)];
+        head++;
+        r->timestamp = RuntimeClock_Cycles32();
+        r->type = type;
+        r->arg = arg;
+        r->value = value;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+void TraceRecorder_Queue(uint8_t type, uint8_t queueType, uint32_t number, uint32_t waiting) {
+    // Queue sets share the plain queue type; everything else is a semaphore.
+    if (queueType != queueQUEUE_TYPE_BASE) {
+        type |= TRACE_FLAG_SEMAPHORE;
+    }
+    TraceRecorder_Record(type, (uint8_t)number, (uint16_t)waiting);
+}
+
+void TraceRecorder_IsrEnter(void) {
+    TraceRecorder_Record(TRACE_EV_ISR_ENTER, (uint8_t)(__get_IPSR() - 16u), 0u);
+}
+
+void TraceRecorder_IsrExit(void) {
+    TraceRecorder_Record(TRACE_EV_ISR_EXIT, (uint8_t)(__get_IPSR() - 16u), 0u);
+}
+
+// Queue numbers are 1-based; 0 (the kernel's own timer queue) stays unnamed.
+void TraceRecorder_RegisterObject(void *handle, const char *name) {
+    if (handle == NULL || objectCount >= TRACE_RECORDER_MAX_OBJECTS) {
+        return;
+    }
+    objectNames[objectCount++] = name;
+    vQueueSetQueueNumber((QueueHandle_t)handle, objectCount);
+}
+
+void TraceRecorder_Start(void) {
+    head = 0u;
+    recording = true;
+}
+
+/* -------------------- DUMP -------------------- */
+static char *put_hex(char *p, const uint8_t *bytes, uint32_t n) {
+    static const char kHex[] = "0123456789abcdef";
+    for (uint32_t i = 0; i < n; ++i) {
+        *p++ = kHex[bytes[i] >> 4];
+        *p++ = kHex[bytes[i] & 0x0Fu];
+    }
+    *p = '\0';
+    return p;
+}
+
+static void emit_task(TraceEmit_t emit, char *line, size_t size, TaskHandle_t task) {
+    if (task == NULL) {
+        return;
+    }
+    snprintf(line, size, "TRACE TASK %u %s", (unsigned)uxTaskGetTaskNumber(task), pcTaskGetName(task));
+    emit(line);
+}
+
+// Recording must be stopped; prints the ring oldest first.
+static uint32_t dump(TraceEmit_t emit) {
+    char line[16u + 2u * RECORDS_PER_LINE * sizeof(TraceRecord_t)];
+    uint32_t count = (head < TRACE_RECORDER_RECORDS) ? head : TRACE_RECORDER_RECORDS;
+    uint32_t first = head - count;
+
+    snprintf(line, sizeof(line), "TRACE BEGIN v1 hz=%lu rec=%lu lost=%lu",
+             (unsigned long)(RuntimeClock_CyclesPerTick() * RUNTIME_CLOCK_HZ),
+             (unsigned long)count, (unsigned long)first);
+    emit(line);
+
+    for (uint8_t i = 0; i < kRtosTaskCount; ++i) {
+        emit_task(emit, line, sizeof(line), *kRtosTaskInfo[i].handle);
+    }
+    emit_task(emit, line, sizeof(line), xTaskGetIdleTaskHandle());
+#if (configUSE_TIMERS == 1)
+    emit_task(emit, line, sizeof(line), xTimerGetTimerDaemonTaskHandle());
+#endif
+    for (uint8_t i = 0; i < objectCount; ++i) {
+        snprintf(line, sizeof(line), "TRACE OBJ %u %s", (unsigned)(i + 1u), objectNames[i]);
+        emit(line);
+    }
+
+    for (uint32_t n = 0; n < count; n += RECORDS_PER_LINE) {
+        char *p = line + sprintf(line, "TRACE D ");
+        for (uint32_t k = n; k < count && k < n + RECORDS_PER_LINE; ++k) {
+            const TraceRecord_t *r = &ring[(first + k) & (TRACE_RECORDER_RECORDS - 1u)];
+            p = put_hex(p, (const uint8_t *)r, sizeof(*r));
+        }
+        emit(line);
+    }
+    emit("TRACE END");
+    return count;
+}
+
+// Bypasses the log rings (log_console.h): the dump is much larger than them.
+static void emit_console(const char *line) {
+    (void)DbgConsole_Printf("%s\r\n", line);
+}
+
+uint32_t TraceRecorder_Dump(void) {
+    taskENTER_CRITICAL();
+    recording = false;
+    taskEXIT_CRITICAL();
+
+    uint32_t count = dump(emit_console);
+
+    taskENTER_CRITICAL();
+    head = 0u;
+    recording = true;
+    taskEXIT_CRITICAL();
+    return count;
+}
+
+/* -------------------- FAULT DUMP -------------------- */
+// Interrupts are off: write straight to the debug LPUART, if it is clocked.
+static void emit_polled(const char *line) {
+    LPUART_Type *uart = (LPUART_Type *)BOARD_DEBUG_UART_BASEADDR;
+    (void)LPUART_WriteBlocking(uart, (const uint8_t *)line, strlen(line));
+    (void)LPUART_WriteBlocking(uart, (const uint8_t *)"\r\n", 2u);
+}
+
+static void __attribute__((noreturn)) fault_dump(const char *reason, const uint32_t *frame) {
+    recording = false;
+    if ((SIM->SCGC5 & SIM_SCGC5_LPUART0_MASK) != 0u) {
+        char line[64];
+        if (frame != NULL) {
+            snprintf(line, sizeof(line), "TRACE FAULT %s pc=%08lx lr=%08lx", reason,
+                     (unsigned long)frame[6], (unsigned long)frame[5]);
+        } else {
+            snprintf(line, sizeof(line), "TRACE FAULT %s", reason);
+        }
+        emit_polled(line);
+        (void)dump(emit_polled);
+    }
+    for (;;) {
+    }
+}
+
+void TraceRecorder_Fault(const char *reason) {
+    taskDISABLE_INTERRUPTS();
+    if ((SIM->SCGC5 & SIM_SCGC5_LPUART0_MASK) != 0u) {
+        LogConsole_Flush();   // what the tasks printed just before
+    }
+    fault_dump(reason, NULL);
+}
+
+// Reached from HardFault_Handler (semihost_hardfault.c) with the stacked
+// exception frame: r0 r1 r2 r3 r12 lr pc xpsr.
+void TraceRecorder_HardFault(const uint32_t *frame) {
+    taskDISABLE_INTERRUPTS();
+    fault_dump("hardfault", frame);
+}
+
+#endif /* configUSE_TRACE_RECORDER */
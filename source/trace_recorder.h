@@ -0,0 +1,110 @@
+#ifndef TRACE_RECORDER_H_
+#define TRACE_RECORDER_H_
+
+#include <stdint.h>
+
+// Flight recorder for the kernel: every task switch, queue send/receive,
+// semaphore give/take (blocking and failed ones too) and instrumented ISR
+// entry/exit is written as an 8-byte record into a RAM ring. The oldest
+// records are overwritten, so the ring always holds the most recent
+// TRACE_RECORDER_RECORDS events.
+//
+// Included by FreeRTOSConfig_Gen.h, which enables it with
+// configUSE_TRACE_RECORDER (off in the benchmark build and the host
+// simulation). This header must not include FreeRTOS.h: the kernel trace
+// macros below are expanded inside tasks.c and queue.c.
+//
+// The ring is printed on the debug console (LPUART0):
+//   - on the TRACE command (CG2271UART.c). Recording pauses while it
+//     prints, then restarts with an empty ring.
+//   - on a hard fault, a failed configASSERT or a stack overflow. It is
+//     written polled, with interrupts off, and the core then stops.
+// tools/trace_export.py converts a captured log into Chrome/Perfetto
+// trace JSON. The dump format:
+//     TRACE FAULT <reason> [pc=<hex> lr=<hex>]        fault dumps only
+//     TRACE BEGIN v1 hz=<cycles/s> rec=<n> lost=<n>
+//     TRACE TASK <number> <name>                      per task
+//     TRACE OBJ <number> <name>                       per registered queue
+//     TRACE D <hex>                                   up to 4 raw records
+//     TRACE END
+
+#ifndef TRACE_RECORDER_RECORDS
+#define TRACE_RECORDER_RECORDS       256u    // power of two; 8 bytes each
+#endif
+#define TRACE_RECORDER_MAX_OBJECTS   12u
+
+// Record: timestamp in bus cycles (RuntimeClock_Cycles32, wraps every
+// ~179 s at 24 MHz), event type, and two event-specific arguments.
+typedef struct {
+    uint32_t timestamp;
+    uint8_t type;
+    uint8_t arg;      // task number, queue number or IRQ number
+    uint16_t value;   // task priority, or messages waiting before the op
+} TraceRecord_t;
+
+typedef enum {
+    TRACE_EV_TASK_IN = 1,        // arg: task number, value: priority
+    TRACE_EV_ISR_ENTER,          // arg: IRQ number
+    TRACE_EV_ISR_EXIT,
+    TRACE_EV_SEND,               // queue send / semaphore give
+    TRACE_EV_RECEIVE,            // queue receive / semaphore take
+    TRACE_EV_BLOCK_SEND,         // the caller is about to block
+    TRACE_EV_BLOCK_RECEIVE,
+    TRACE_EV_SEND_FAILED,        // full / timed out
+    TRACE_EV_RECEIVE_FAILED,     // empty / timed out
+} TraceEvent_t;
+
+// OR-ed into the type of queue events
+#define TRACE_FLAG_SEMAPHORE   0x40u
+#define TRACE_FLAG_FROM_ISR    0x80u
+
+#if (configUSE_TRACE_RECORDER == 1)
+
+void TraceRecorder_Record(uint8_t type, uint8_t arg, uint16_t value);
+void TraceRecorder_Queue(uint8_t type, uint8_t queueType, uint32_t number, uint32_t waiting);
+void TraceRecorder_IsrEnter(void);
+void TraceRecorder_IsrExit(void);
+
+// Names a queue/semaphore for the dump and sets its kernel queue number;
+// called from RtosObjects_Init. handle is a QueueHandle_t.
+void TraceRecorder_RegisterObject(void *handle, const char *name);
+// Starts recording; needs RuntimeClock_Init first (the PIT must be clocked).
+void TraceRecorder_Start(void);
+// Task context: prints the ring on the debug console, then restarts it. Returns the
+// number of records printed.
+uint32_t TraceRecorder_Dump(void);
+// Fault paths: polled dump with interrupts off, then halt.
+void TraceRecorder_Fault(const char *reason) __attribute__((noreturn));
+void TraceRecorder_HardFault(const uint32_t *frame) __attribute__((noreturn));
+
+#define TRACE_RECORDER_FAULT(reason)    TraceRecorder_Fault(reason)
+
+/* Kernel hooks (FreeRTOS.h defaults them to nothing) */
+#define traceTASK_SWITCHED_IN() \
+    TraceRecorder_Record(TRACE_EV_TASK_IN, (uint8_t)pxCurrentTCB->uxTCBNumber, (uint16_t)pxCurrentTCB->uxPriority)
+
+#define TRACE_RECORDER_QUEUE(type, q) \
+    TraceRecorder_Queue((type), (q)->ucQueueType, (uint32_t)(q)->uxQueueNumber, (uint32_t)(q)->uxMessagesWaiting)
+
+#define traceQUEUE_SEND(q)                     TRACE_RECORDER_QUEUE(TRACE_EV_SEND, q)
+#define traceQUEUE_SEND_FROM_ISR(q)            TRACE_RECORDER_QUEUE(TRACE_EV_SEND | TRACE_FLAG_FROM_ISR, q)
+#define traceQUEUE_SEND_FAILED(q)              TRACE_RECORDER_QUEUE(TRACE_EV_SEND_FAILED, q)
+#define traceQUEUE_SEND_FROM_ISR_FAILED(q)     TRACE_RECORDER_QUEUE(TRACE_EV_SEND_FAILED | TRACE_FLAG_FROM_ISR, q)
+#define traceBLOCKING_ON_QUEUE_SEND(q)         TRACE_RECORDER_QUEUE(TRACE_EV_BLOCK_SEND, q)
+#define traceQUEUE_RECEIVE(q)                  TRACE_RECORDER_QUEUE(TRACE_EV_RECEIVE, q)
+#define traceQUEUE_RECEIVE_FROM_ISR(q)         TRACE_RECORDER_QUEUE(TRACE_EV_RECEIVE | TRACE_FLAG_FROM_ISR, q)
+#define traceQUEUE_RECEIVE_FAILED(q)           TRACE_RECORDER_QUEUE(TRACE_EV_RECEIVE_FAILED, q)
+#define traceQUEUE_RECEIVE_FROM_ISR_FAILED(q)  TRACE_RECORDER_QUEUE(TRACE_EV_RECEIVE_FAILED | TRACE_FLAG_FROM_ISR, q)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(q)      TRACE_RECORDER_QUEUE(TRACE_EV_BLOCK_RECEIVE, q)
+
+#else
+
+#define TraceRecorder_IsrEnter()                  ((void)0)
+#define TraceRecorder_IsrExit()                   ((void)0)
+#define TraceRecorder_RegisterObject(h, name)     ((void)0)
+#define TraceRecorder_Start()                     ((void)0)
+#define TRACE_RECORDER_FAULT(reason)
+
+#endif /* configUSE_TRACE_RECORDER */
+
+#endif /* TRACE_RECORDER_H_ */
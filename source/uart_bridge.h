@@ -6,11 +6,25 @@
 #include "FreeRTOS.h"
 #include "semphr.h"
 
+#include "event_hub.h"
 #include "sensor.h"
 
+#define UART_BRIDGE_MAX_MSG_LEN  128u  // one newline-terminated line, incl. NUL
+
 void UART_Bridge_Init(uint32_t baud_rate);
 void UART_Bridge_SetSensorDataHandle(SensorData_t *sharedData, SemaphoreHandle_t dataMutex);
-void UART_Bridge_StartTasks(UBaseType_t recvPriority, UBaseType_t pollPriority);
+// Hub handlers (HUB_EVENT_TABLE): a received line, the DHT/STATS poll
+// timer, and a new sensor sample (telemetry, rate-limited)
+void UART_Bridge_OnFrame(HubEvent_t event, const void *payload);
+void UART_Bridge_OnPollTimer(HubEvent_t event, const void *payload);
+void UART_Bridge_OnSensorUpdate(HubEvent_t event, const void *payload);
+// Sends the STATS report and the TRACE dump when the hub asks for them; both
+// are paced by UART2 or the debug console, so they run at low priority
+// rather than in the hub.
+void UART_Bridge_StatsTask(void *pvParameters);
+// Lines are queued whole to the UartTx stream buffer and sent by the UART2
+// TX interrupt. While the buffer is full the sender waits up to 50 ms, then
+// gives up with pdFAIL; dropped lines are counted in STAT uart.
 BaseType_t UART_Bridge_Send(const char *msg);
 BaseType_t UART_Bridge_SendSensorTelemetry(const SensorData_t *data);
 
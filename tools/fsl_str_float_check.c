@@ -0,0 +1,95 @@
+/*
+ * @file    fsl_str_float_check.c
+ * @brief   Host check: fsl_str's fixed-point %f path against the double routine
+ *
+ * Compiles utilities/str/fsl_str.c into this file twice, with
+ * PRINTF_FLOAT_FIXED_POINT 0 and 1, and compares what its %f converter
+ * produces for precisions 0..9 over random and sensor-like values. Run from
+ * the repository root:
+ *
+ *   FLAGS="-O1 -DFSL_COMMON_H_ -include stdbool.h -include stdint.h -include string.h
+ *          -Idrivers -Iutilities/str -DPRINTF_FLOAT_ENABLE=1"
+ *   cc $FLAGS -DPRINTF_FLOAT_FIXED_POINT=0 -DCHECK_CONVERT=ConvertRef -DStrFormatPrintf=StrFormatPrintfRef \
+ *      -DStrFormatScanf=StrFormatScanfRef -c tools/fsl_str_float_check.c -o /tmp/str_ref.o
+ *   cc $FLAGS -DPRINTF_FLOAT_FIXED_POINT=1 -DCHECK_CONVERT=ConvertFast -DCHECK_MAIN \
+ *      -c tools/fsl_str_float_check.c -o /tmp/str_fast.o
+ *   cc /tmp/str_ref.o /tmp/str_fast.o -lm -o /tmp/str_float_check
+ *   /tmp/str_float_check [values]
+ *
+ * The converter is called directly rather than through StrFormatPrintf:
+ * fsl_str.c passes va_list by address, which breaks on hosts where va_list
+ * is an array type (x86-64).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fsl_str.c"
+
+// The digits in reading order, as StrFormatPrintf would print them.
+int CHECK_CONVERT(char *out, double v, uint32_t precision) {
+    char rev[40];
+    int32_t n = ConvertFloatRadixNumToString(rev, &v, 10, precision);
+    for (int32_t i = 0; i < n; ++i) {
+        out[i] = rev[n - i];
+    }
+    out[n] = '\0';
+    return (int)n;
+}
+
+#ifdef CHECK_MAIN
+
+int ConvertRef(char *out, double v, uint32_t precision);
+int ConvertFast(char *out, double v, uint32_t precision);
+
+static uint64_t rng = 0x9E3779B97F4A7C15ULL;
+static uint64_t next(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng;
+}
+
+// Mix of: raw bit patterns below 2^31, sensor-range values with few
+// decimals (ties like x.125 included), and small fractions.
+static double sample(uint64_t i) {
+    uint64_t r = next();
+    switch (i % 4u) {
+    case 0: {
+        double d;
+        uint64_t bits = r & 0x41DFFFFFFFFFFFFFULL;   // exponent up to 2^30
+        memcpy(&d, &bits, sizeof(d));
+        return (r >> 63) ? -d : d;
+    }
+    case 1:
+        return (double)(int32_t)(r % 2000000u - 1000000) / 1000.0;
+    case 2:
+        return (double)(r % 100000u) / 8.0 - 5000.0;
+    default:
+        return (double)(r % 1000000000u) * 1e-9 * ((r & 1u) ? 1.0 : 100.0);
+    }
+}
+
+int main(int argc, char **argv) {
+    uint64_t count = (argc > 1) ? strtoull(argv[1], NULL, 0) : 10000000u;
+    uint64_t mismatches = 0;
+    char ref[48];
+    char fast[48];
+
+    for (uint64_t i = 0; i < count; ++i) {
+        double v = sample(i);
+        uint32_t p = (uint32_t)(i % 10u);
+        int nr = ConvertRef(ref, v, p);
+        int nf = ConvertFast(fast, v, p);
+        if (nr != nf || strcmp(ref, fast) != 0) {
+            if (mismatches++ < 10u) {
+                printf("MISMATCH %%.%uf of %.17g: ref \"%s\" fast \"%s\"\n", (unsigned)p, v, ref, fast);
+            }
+        }
+    }
+    printf("%llu values, %llu mismatches\n", (unsigned long long)count, (unsigned long long)mismatches);
+    return (mismatches == 0u) ? 0 : 1;
+}
+
+#endif /* CHECK_MAIN */
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Turn tokenized log lines back into text.
+
+LOG_TOKEN() call sites (source/log_token.h) print "$<base64>" lines that
+hold a format-string ID and the raw arguments. The format strings are in
+the .logfmt section of the firmware ELF, which is never loaded onto the
+device. This tool reads them from the ELF and formats each line on the
+host. Every other line passes through unchanged.
+
+    python3 tools/log_detokenize.py Debug/GP.axf console.txt
+    picocom -b 115200 /dev/ttyACM0 | python3 tools/log_detokenize.py Debug/GP.axf -
+
+Use the ELF built from the same source as the running firmware: the IDs
+are offsets into .logfmt and change with every build.
+"""
+
+import argparse
+import base64
+import binascii
+import re
+import struct
+import sys
+
+SECTION = ".logfmt"
+FRAME = re.compile(r"\$([A-Za-z0-9+/]+={0,2})")
+CONVERSION = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|z|j|t|L)?([diouxXcspfFeEgG%])")
+
+
+def read_section(path, name):
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF":
+        raise ValueError("%s is not an ELF file" % path)
+    is64 = elf[4] == 2
+    end = "<" if elf[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", elf, 0x3A)
+        hdr = end + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(end + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", elf, 0x2E)
+        hdr = end + "IIIIIIIIII"
+    sections = [struct.unpack_from(hdr, elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = sections[shstrndx]
+    names = elf[strtab[4]:strtab[4] + strtab[5]]
+    for sh in sections:
+        sname = names[sh[0]:names.index(b"\0", sh[0])].decode()
+        if sname == name:
+            return elf[sh[4]:sh[4] + sh[5]]
+    raise ValueError("%s has no %s section (no LOG_TOKEN call sites, or LOG_TOKEN_ENABLE is 0)" % (path, name))
+
+
+class Payload:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            if self.pos >= len(self.data):
+                raise EOFError
+            b = self.data[self.pos]
+            self.pos += 1
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if b < 0x80:
+                return value
+
+    def signed(self):
+        v = self.varint()
+        return (v >> 1) ^ -(v & 1)
+
+    def double(self):
+        if self.pos + 8 > len(self.data):
+            raise EOFError
+        v, = struct.unpack_from("<d", self.data, self.pos)
+        self.pos += 8
+        return v
+
+    def string(self):
+        head = self.data[self.pos] if self.pos < len(self.data) else None
+        if head is None or self.pos + 1 + (head & 0x7F) > len(self.data):
+            raise EOFError
+        n = head & 0x7F
+        s = self.data[self.pos + 1:self.pos + 1 + n].decode("utf-8", "replace")
+        self.pos += 1 + n
+        return s + ("..." if head & 0x80 else "")
+
+
+def fmt_string(strings, offset):
+    if offset >= len(strings):
+        return None
+    end = strings.find(b"\0", offset)
+    return strings[offset:end if end >= 0 else len(strings)].decode("utf-8", "replace")
+
+
+def detokenize(strings, data):
+    p = Payload(data)
+    try:
+        fmt = fmt_string(strings, p.varint())
+    except EOFError:
+        return None
+    if fmt is None:
+        return None
+
+    def conversion(m):
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            return "%"
+        if width == "*" or prec == "*":
+            return m.group(0)   # not supported by the encoder
+        spec = "%" + flags + (width or "") + ("." + prec if prec else "")
+        try:
+            if conv in "fFeEgG":
+                return (spec + conv) % p.double()
+            if conv == "s":
+                return (spec + "s") % p.string()
+            v = p.signed()
+            if conv in "ouxXc":
+                v &= 0xFFFFFFFFFFFFFFFF if length == "ll" else 0xFFFFFFFF
+            if conv == "c":
+                return (spec + "c") % chr(v & 0xFF)
+            if conv == "p":
+                return "0x%08x" % (v & 0xFFFFFFFF)
+            return (spec + ("d" if conv in "iu" else conv)) % v
+        except EOFError:
+            return "<?>"
+
+    return CONVERSION.sub(conversion, fmt)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("elf", help="firmware ELF (Debug/GP.axf)")
+    ap.add_argument("log", nargs="?", default="-", help="console capture ('-' for stdin, the default)")
+    args = ap.parse_args()
+
+    try:
+        strings = read_section(args.elf, SECTION)
+    except (OSError, ValueError) as e:
+        print(e, file=sys.stderr)
+        return 1
+
+    def frame(m):
+        try:
+            data = base64.b64decode(m.group(1), validate=True)
+        except (binascii.Error, ValueError):
+            return m.group(0)
+        text = detokenize(strings, data)
+        return m.group(0) if text is None else text.rstrip("\r\n")
+
+    src = sys.stdin if args.log == "-" else open(args.log, errors="replace")
+    with src:
+        for line in src:
+            sys.stdout.write(FRAME.sub(frame, line.rstrip("\r\n")) + "\n")
+            sys.stdout.flush()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
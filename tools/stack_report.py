@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""Recommend task stack sizes from runtime marks and -fstack-usage data.
+
+Inputs:
+  * source/rtos_objects.h       task names, entry functions, configured sizes
+  * Debug/**/*.su               per-function frame sizes (-fstack-usage)
+  * Debug/GP.axf (optional)     call graph, recovered from Thumb BL instructions
+  * a console log (optional)    "STACK <name> <size> <free>" lines printed by
+                                source/stack_monitor.c
+
+    python3 tools/stack_report.py --log console.txt
+
+For every task the report shows the configured size, the deepest use seen
+at runtime (size - minimum free), the static worst case along the call
+graph from the task entry, and a recommended size:
+
+    max(runtime, static + context) * margin, rounded up to 8 words
+
+"context" is the 16 words an exception entry plus the PendSV context save
+push onto a task stack on the M0+. Calls through function pointers are not
+followed; tasks that make them are marked '*', and recursion '!'.
+"""
+
+import argparse
+import glob
+import math
+import os
+import re
+import struct
+import sys
+
+WORD = 4
+CONTEXT_WORDS = 16
+
+KERNEL_TASKS = [
+    # name, entry, size expression
+    ("IDLE", "prvIdleTask", "configMINIMAL_STACK_SIZE"),
+    ("Tmr Svc", "prvTimerTask", "configTIMER_TASK_STACK_DEPTH"),
+]
+
+
+# ---------------------------------------------------------------- config
+def read_config(path):
+    defines = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"\s*#define\s+(config\w+)\s+(.+?)\s*(/\*.*)?$", line)
+            if m:
+                defines[m.group(1)] = m.group(2)
+    return defines
+
+
+def eval_expr(expr, defines, depth=0):
+    expr = re.sub(r"\(\s*(unsigned\s+short|uint16_t|size_t|TickType_t)\s*\)", "", expr)
+    if depth > 8:
+        raise ValueError(expr)
+
+    def sub(m):
+        name = m.group(0)
+        if name in defines:
+            return "(%d)" % eval_expr(defines[name], defines, depth + 1)
+        raise ValueError("unknown symbol %s" % name)
+
+    expr = re.sub(r"[A-Za-z_]\w*", sub, expr)
+    expr = re.sub(r"(\d+)[uUlL]+", r"\1", expr)
+    return int(eval(expr, {"__builtins__": {}}))
+
+
+def read_task_table(path):
+    tasks = []
+    pattern = re.compile(r'X\(\s*(\w+)\s*,\s*"([^"]+)"\s*,\s*(\w+)\s*,\s*([^,]+?)\s*,\s*(\d+)\s*\)')
+    with open(path) as f:
+        text = f.read()
+    # Only the application table; the RTOS_BENCH build has its own.
+    text = re.sub(r"#ifdef RTOS_BENCH.*?#else", "", text, flags=re.S)
+    for m in pattern.finditer(text):
+        tasks.append((m.group(2), m.group(3), m.group(4)))
+    return tasks
+
+
+# ---------------------------------------------------------------- .su files
+def read_su(root):
+    frames = {}
+    dynamic = set()
+    for path in glob.glob(os.path.join(root, "**", "*.su"), recursive=True):
+        with open(path, errors="replace") as f:
+            for line in f:
+                parts = line.rstrip("\n").split("\t")
+                if len(parts) < 3:
+                    continue
+                name = parts[0].rsplit(":", 1)[-1]
+                size = int(parts[1])
+                frames[name] = max(frames.get(name, 0), size)
+                if "dynamic" in parts[2] and "bounded" not in parts[2]:
+                    dynamic.add(name)
+    return frames, dynamic
+
+
+# ---------------------------------------------------------------- ELF call graph
+def read_elf_functions(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF" or data[4] != 1:
+        raise ValueError("not a 32-bit ELF file")
+    (e_shoff,) = struct.unpack_from("<I", data, 0x20)
+    e_shentsize, e_shnum, e_shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+
+    sections = []
+    for i in range(e_shnum):
+        sections.append(struct.unpack_from("<IIIIIIIIII", data, e_shoff + i * e_shentsize))
+
+    funcs = {}
+    for sh in sections:
+        if sh[1] != 2:  # SHT_SYMTAB
+            continue
+        strtab = sections[sh[6]]
+        for off in range(sh[4], sh[4] + sh[5], 16):
+            st_name, st_value, st_size, st_info, _, st_shndx = struct.unpack_from("<IIIBBH", data, off)
+            if (st_info & 0xF) != 2 or st_size == 0 or st_shndx >= len(sections):
+                continue
+            end = data.index(b"\0", strtab[4] + st_name)
+            name = data[strtab[4] + st_name:end].decode(errors="replace")
+            sec = sections[st_shndx]
+            addr = st_value & ~1
+            start = sec[4] + (addr - sec[3])
+            funcs[addr] = (name, data[start:start + st_size])
+    return funcs
+
+
+def thumb_calls(addr, code):
+    """Direct BL targets and whether the function makes indirect calls."""
+    targets = set()
+    indirect = False
+    i = 0
+    while i + 2 <= len(code):
+        hw1 = code[i] | (code[i + 1] << 8)
+        if (hw1 & 0xF800) == 0xF000 and i + 4 <= len(code):
+            hw2 = code[i + 2] | (code[i + 3] << 8)
+            if (hw2 & 0xD000) == 0xD000:
+                s = (hw1 >> 10) & 1
+                i1 = 1 - (((hw2 >> 13) & 1) ^ s)
+                i2 = 1 - (((hw2 >> 11) & 1) ^ s)
+                imm = (s << 24) | (i1 << 23) | (i2 << 22) | ((hw1 & 0x3FF) << 12) | ((hw2 & 0x7FF) << 1)
+                if s:
+                    imm -= 1 << 25
+                targets.add(addr + i + 4 + imm)
+                i += 4
+                continue
+        if (hw1 & 0xFF87) == 0x4780:  # BLX Rm
+            indirect = True
+        i += 2
+    return targets, indirect
+
+
+class CallGraph:
+    def __init__(self, funcs, frames, dynamic):
+        self.by_name = {}
+        self.edges = {}
+        self.indirect = set()
+        for addr, (name, code) in funcs.items():
+            targets, indirect = thumb_calls(addr, code)
+            callees = {funcs[t][0] for t in targets if t in funcs}
+            self.edges.setdefault(name, set()).update(callees)
+            if indirect:
+                self.indirect.add(name)
+        self.frames = frames
+        self.dynamic = dynamic
+        self.memo = {}
+
+    def worst(self, name, stack=()):
+        """(bytes, flags) of the deepest path starting at name."""
+        if name in self.memo:
+            return self.memo[name]
+        if name in stack:
+            return 0, {"!"}
+        flags = set()
+        if name in self.indirect:
+            flags.add("*")
+        if name in self.dynamic:
+            flags.add("?")
+        deepest = 0
+        for callee in self.edges.get(name, ()):
+            depth, sub = self.worst(callee, stack + (name,))
+            flags |= sub
+            deepest = max(deepest, depth)
+        result = (self.frames.get(name, 0) + deepest, flags)
+        self.memo[name] = result
+        return result
+
+
+# ---------------------------------------------------------------- runtime log
+def read_log(path):
+    marks = {}
+    pattern = re.compile(r"STACK (.+) (\d+) (\d+)(?: LOW)?\s*$")
+    with open(path, errors="replace") as f:
+        for line in f:
+            m = pattern.search(line)
+            if m:
+                name, size, free = m.group(1), int(m.group(2)), int(m.group(3))
+                prev = marks.get(name)
+                marks[name] = (size, free if prev is None else min(prev[1], free))
+    return marks
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    repo = os.path.dirname(here)
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--table", default=os.path.join(repo, "source", "rtos_objects.h"))
+    ap.add_argument("--config", default=os.path.join(
+        repo, "freertos", "freertos-kernel", "template", "ARM_CM0", "FreeRTOSConfig_Gen.h"))
+    ap.add_argument("--su-dir", default=os.path.join(repo, "Debug"))
+    ap.add_argument("--axf", default=os.path.join(repo, "Debug", "GP.axf"))
+    ap.add_argument("--log", help="console capture with STACK lines")
+    ap.add_argument("--margin", type=float, default=1.25)
+    args = ap.parse_args()
+
+    defines = read_config(args.config)
+    frames, dynamic = read_su(args.su_dir)
+    graph = None
+    if args.axf and os.path.exists(args.axf):
+        graph = CallGraph(read_elf_functions(args.axf), frames, dynamic)
+    marks = read_log(args.log) if args.log else {}
+
+    rows = [(n, e, s) for n, e, s in read_task_table(args.table)] + KERNEL_TASKS
+    print("%-14s %-26s %6s %7s %7s %6s" % ("task", "entry", "size", "runtime", "static", "recom"))
+    total_now = total_rec = 0
+    for name, entry, expr in rows:
+        try:
+            size = eval_expr(expr, defines)
+        except ValueError:
+            size = None
+        used = None
+        if name in marks:
+            msize, free = marks[name]
+            size = size or msize
+            used = msize - free
+
+        static = None
+        flags = ""
+        if graph is not None and entry in graph.edges:
+            nbytes, fl = graph.worst(entry)
+            static = math.ceil(nbytes / WORD)
+            flags = "".join(sorted(fl))
+        elif entry in frames:
+            static = math.ceil(frames[entry] / WORD)
+            flags = "~"  # entry frame only, no call graph
+
+        need = max(used or 0, (static + CONTEXT_WORDS) if static is not None else 0)
+        rec = int(math.ceil(need * args.margin / 8.0) * 8) if need else None
+        total_now += size or 0
+        total_rec += rec or size or 0
+        print("%-14s %-26s %6s %7s %7s %6s %s" % (
+            name, entry, size if size is not None else "?", used if used is not None else "-",
+            static if static is not None else "-", rec if rec is not None else "-", flags))
+
+    print("\nwords: configured %d, recommended %d (%+d bytes)" % (
+        total_now, total_rec, (total_rec - total_now) * WORD))
+    print("flags: * indirect calls not followed, ! recursion, ? dynamic frame, ~ no call graph")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""Convert a kernel trace dump into Chrome / Perfetto trace JSON.
+
+Input: a debug-console capture with the TRACE BEGIN .. TRACE END block
+printed by source/trace_recorder.c. The MCXC prints it when the TRACE
+command arrives (typed on the ESP32's USB serial) or when it faults.
+
+    python3 tools/trace_export.py console.txt -o trace.json
+
+Open the result in https://ui.perfetto.dev or chrome://tracing:
+  * one track per task, with a slice for every stretch it ran
+  * one track per interrupt, with a slice per handler run
+  * instant markers for queue sends/receives and semaphore gives/takes on
+    the task or interrupt that did them. Blocking and failed (full, empty,
+    timed out) operations get their own names.
+  * a counter per queue/semaphore with its item count after each operation
+
+A log holding several dumps is converted from the last one unless --dump
+picks another (0 = first). Timestamps are bus cycles, 32 bits wide on the
+target. They are unwrapped here, which assumes no gap longer than one
+wrap (~179 s at 24 MHz) between records.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+EV_TASK_IN = 1
+EV_ISR_ENTER = 2
+EV_ISR_EXIT = 3
+EV_SEND = 4
+EV_RECEIVE = 5
+EV_BLOCK_SEND = 6
+EV_BLOCK_RECEIVE = 7
+EV_SEND_FAILED = 8
+EV_RECEIVE_FAILED = 9
+FLAG_SEMAPHORE = 0x40
+FLAG_FROM_ISR = 0x80
+
+QUEUE_NAMES = {
+    # (queue name, semaphore name)
+    EV_SEND: ("send", "give"),
+    EV_RECEIVE: ("receive", "take"),
+    EV_BLOCK_SEND: ("block send", "block give"),
+    EV_BLOCK_RECEIVE: ("block receive", "block take"),
+    EV_SEND_FAILED: ("send failed", "give failed"),
+    EV_RECEIVE_FAILED: ("receive failed", "take failed"),
+}
+
+# MCXC444 IRQ numbers (device/MCXC444_COMMON.h)
+IRQ_NAMES = {
+    0: "DMA0", 1: "DMA1", 2: "DMA2", 3: "DMA3", 5: "FTFA", 6: "PMC", 7: "LLWU",
+    8: "I2C0", 9: "I2C1", 10: "SPI0", 11: "SPI1", 12: "LPUART0", 13: "LPUART1",
+    14: "UART2_FLEXIO", 15: "ADC0", 16: "CMP0", 17: "TPM0", 18: "TPM1", 19: "TPM2",
+    20: "RTC", 21: "RTC_Seconds", 22: "PIT", 23: "I2S0", 24: "USB0", 25: "DAC0",
+    28: "LPTMR0", 29: "LCD", 30: "PORTA", 31: "PORTC_PORTD",
+}
+
+PID = 1
+IRQ_TID_BASE = 1000
+RECORD = struct.Struct("<IBBH")
+
+
+class Dump:
+    def __init__(self):
+        self.hz = 0
+        self.lost = 0
+        self.fault = None
+        self.tasks = {}
+        self.objects = {}
+        self.records = []
+
+
+def read_dumps(lines):
+    dumps = []
+    cur = None
+    fault = None
+    for line in lines:
+        # The console may interleave other output; match anywhere in the line.
+        m = re.search(r"TRACE (FAULT|BEGIN|TASK|OBJ|D|END)\b ?(.*)$", line.rstrip("\r\n"))
+        if not m:
+            continue
+        kind, rest = m.group(1), m.group(2).strip()
+        if kind == "FAULT":
+            fault = rest
+        elif kind == "BEGIN":
+            cur = Dump()
+            fields = dict(f.split("=", 1) for f in rest.split() if "=" in f)
+            cur.hz = int(fields.get("hz", "0"))
+            cur.lost = int(fields.get("lost", "0"))
+            cur.fault, fault = fault, None
+        elif cur is None:
+            continue
+        elif kind == "TASK":
+            num, _, name = rest.partition(" ")
+            cur.tasks[int(num)] = name
+        elif kind == "OBJ":
+            num, _, name = rest.partition(" ")
+            cur.objects[int(num)] = name
+        elif kind == "D":
+            try:
+                raw = bytes.fromhex(rest)
+            except ValueError:
+                continue  # garbled line
+            for off in range(0, len(raw) - RECORD.size + 1, RECORD.size):
+                cur.records.append(RECORD.unpack_from(raw, off))
+        elif kind == "END":
+            dumps.append(cur)
+            cur = None
+    return dumps
+
+
+def convert(dump):
+    if dump.hz <= 0:
+        raise ValueError("dump has no clock rate")
+    events = [{"ph": "M", "pid": PID, "name": "process_name", "args": {"name": "MCXC444"}}]
+    for num, name in sorted(dump.tasks.items()):
+        events.append({"ph": "M", "pid": PID, "tid": num, "name": "thread_name",
+                       "args": {"name": "%s (%d)" % (name, num)}})
+        events.append({"ph": "M", "pid": PID, "tid": num, "name": "thread_sort_index",
+                       "args": {"sort_index": num}})
+    seen_irqs = set()
+
+    def us(cycles):
+        return cycles * 1e6 / dump.hz
+
+    def obj_name(num):
+        return dump.objects.get(num, "obj%d" % num)
+
+    base = None
+    last = 0
+    t = 0
+    running = None      # (task number, priority, start time)
+    isr_stack = []
+    for stamp, etype, arg, value in dump.records:
+        # Unwrap the 32-bit cycle counter
+        if base is None:
+            base, last, t = stamp, stamp, 0
+        else:
+            t += (stamp - last) & 0xFFFFFFFF
+            last = stamp
+        ts = us(t)
+        ev = etype & 0x3F
+
+        if ev == EV_TASK_IN:
+            if running is not None:
+                num, prio, start = running
+                events.append({"ph": "X", "pid": PID, "tid": num, "ts": us(start), "dur": ts - us(start),
+                               "name": dump.tasks.get(num, "task%d" % num), "args": {"priority": prio}})
+            running = (arg, value, t)
+        elif ev == EV_ISR_ENTER:
+            if arg not in seen_irqs:
+                seen_irqs.add(arg)
+                events.append({"ph": "M", "pid": PID, "tid": IRQ_TID_BASE + arg, "name": "thread_name",
+                               "args": {"name": "IRQ %s" % IRQ_NAMES.get(arg, str(arg))}})
+            isr_stack.append(arg)
+            events.append({"ph": "B", "pid": PID, "tid": IRQ_TID_BASE + arg, "ts": ts,
+                           "name": IRQ_NAMES.get(arg, "IRQ%d" % arg)})
+        elif ev == EV_ISR_EXIT:
+            if arg in isr_stack:
+                isr_stack.remove(arg)
+                events.append({"ph": "E", "pid": PID, "tid": IRQ_TID_BASE + arg, "ts": ts})
+        elif ev in QUEUE_NAMES:
+            sem = bool(etype & FLAG_SEMAPHORE)
+            from_isr = bool(etype & FLAG_FROM_ISR)
+            if from_isr and isr_stack:
+                tid = IRQ_TID_BASE + isr_stack[-1]
+            elif running is not None:
+                tid = running[0]
+            else:
+                tid = 0
+            name = "%s %s" % (QUEUE_NAMES[ev][1 if sem else 0], obj_name(arg))
+            events.append({"ph": "i", "s": "t", "pid": PID, "tid": tid, "ts": ts, "name": name,
+                           "args": {"waiting_before": value, "from_isr": from_isr}})
+            # The hook runs before the copy: successful ops move the count.
+            after = value + 1 if ev == EV_SEND else value - 1 if ev == EV_RECEIVE else value
+            events.append({"ph": "C", "pid": PID, "ts": ts, "name": obj_name(arg),
+                           "args": {"items": max(after, 0)}})
+
+    if running is not None:
+        num, prio, start = running
+        events.append({"ph": "X", "pid": PID, "tid": num, "ts": us(start), "dur": us(t) - us(start),
+                       "name": dump.tasks.get(num, "task%d" % num), "args": {"priority": prio}})
+    if dump.fault:
+        events.append({"ph": "i", "s": "g", "pid": PID, "tid": 0, "ts": us(t),
+                       "name": "FAULT %s" % dump.fault})
+
+    meta = {"records": len(dump.records), "lost": dump.lost, "clock_hz": dump.hz}
+    if dump.fault:
+        meta["fault"] = dump.fault
+    return {"traceEvents": events, "displayTimeUnit": "ns", "otherData": meta}
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("log", help="console capture ('-' for stdin)")
+    ap.add_argument("-o", "--output", default="-", help="trace JSON (default stdout)")
+    ap.add_argument("--dump", type=int, default=-1, help="which dump in the log (default: last)")
+    args = ap.parse_args()
+
+    if args.log == "-":
+        dumps = read_dumps(sys.stdin)
+    else:
+        with open(args.log, errors="replace") as f:
+            dumps = read_dumps(f)
+    if not dumps:
+        print("no complete TRACE BEGIN .. TRACE END block in %s" % args.log, file=sys.stderr)
+        return 1
+    try:
+        dump = dumps[args.dump]
+    except IndexError:
+        print("log has %d dump(s)" % len(dumps), file=sys.stderr)
+        return 1
+
+    trace = convert(dump)
+    if args.output == "-":
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+    print("%d records (%d lost before the ring), %d tasks, %d objects%s" % (
+        len(dump.records), dump.lost, len(dump.tasks), len(dump.objects),
+        ", fault: " + dump.fault if dump.fault else ""), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
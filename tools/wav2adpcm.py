@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Convert audio into IMA ADPCM clips for source/audio_clips.c.
+
+Each clip is either a mono 16-bit PCM WAV file (resampled to 8 kHz by
+nearest-sample picking) or one of the built-in synthesized alerts, so the
+default clips can be regenerated without any audio assets:
+
+    python3 tools/wav2adpcm.py -o source/audio_clips.c \
+        alert=synth:alert chime=synth:chime [name=path/to/file.wav ...]
+
+The encoder matches the decoder in source/audio_player.c (standard IMA
+ADPCM, low nibble first, predictor/index reset to 0 at clip start).
+"""
+
+import argparse
+import math
+import struct
+import sys
+import wave
+
+SAMPLE_RATE = 8000
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209,
+    230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876,
+    963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749,
+    3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385,
+    24623, 27086, 29794, 32767,
+]
+
+
+def adpcm_encode(samples):
+    predictor = 0
+    index = 0
+    nibbles = []
+    for s in samples:
+        step = STEP_TABLE[index]
+        diff = s - predictor
+        code = 0
+        if diff < 0:
+            code = 8
+            diff = -diff
+        delta = step >> 3
+        if diff >= step:
+            code |= 4
+            diff -= step
+            delta += step
+        step >>= 1
+        if diff >= step:
+            code |= 2
+            diff -= step
+            delta += step
+        step >>= 1
+        if diff >= step:
+            code |= 1
+            delta += step
+        predictor += -delta if code & 8 else delta
+        predictor = max(-32768, min(32767, predictor))
+        index = max(0, min(88, index + INDEX_TABLE[code]))
+        nibbles.append(code)
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2))
+
+
+def envelope(i, n, attack=80, release=400):
+    return min(1.0, i / attack, (n - i) / release)
+
+
+def synth(kind):
+    out = []
+    if kind == 'alert':
+        # Two-tone "dee-doo" siren, repeated twice.
+        for _ in range(2):
+            for freq, ms in ((1400, 180), (950, 180)):
+                n = SAMPLE_RATE * ms // 1000
+                for i in range(n):
+                    v = math.sin(2 * math.pi * freq * i / SAMPLE_RATE)
+                    out.append(int(12000 * envelope(i, n) * v))
+            out.extend([0] * (SAMPLE_RATE * 40 // 1000))
+    elif kind == 'chime':
+        # Decaying two-partial bell.
+        n = SAMPLE_RATE * 600 // 1000
+        for i in range(n):
+            t = i / SAMPLE_RATE
+            v = math.sin(2 * math.pi * 880 * t) + 0.5 * math.sin(2 * math.pi * 1320 * t)
+            out.append(int(9000 * math.exp(-5 * t) * envelope(i, n, release=200) * v))
+    else:
+        raise SystemExit('unknown synth clip: %s' % kind)
+    return out
+
+
+def read_wav(path):
+    with wave.open(path, 'rb') as w:
+        if w.getsampwidth() != 2:
+            raise SystemExit('%s: need 16-bit PCM' % path)
+        rate = w.getframerate()
+        channels = w.getnchannels()
+        raw = w.readframes(w.getnframes())
+    frames = struct.unpack('<%dh' % (len(raw) // 2), raw)[::channels]
+    count = len(frames) * SAMPLE_RATE // rate
+    return [frames[i * rate // SAMPLE_RATE] for i in range(count)]
+
+
+def emit(clips, out):
+    lines = [
+        '/*',
+        ' * @file    audio_clips.c',
+        ' * @brief   IMA ADPCM alert clips (8 kHz mono)',
+        ' *',
+        ' * Generated by tools/wav2adpcm.py - regenerate instead of editing.',
+        ' */',
+        '',
+        '#include "audio_clips.h"',
+        '',
+    ]
+    for name, (data, count) in clips.items():
+        lines.append('static const uint8_t kClip_%s[%d] = {' % (name, len(data)))
+        for i in range(0, len(data), 16):
+            lines.append('    ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+    lines.append('const AudioClip_t kAudioClips[AUDIO_CLIP_COUNT] = {')
+    for name, (data, count) in clips.items():
+        lines.append('    [AUDIO_CLIP_%s] = { kClip_%s, %du },' % (name.upper(), name, count))
+    lines.append('};')
+    out.write('\n'.join(lines) + '\n')
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument('-o', '--output', default='-')
+    ap.add_argument('clips', nargs='+', help='name=synth:<kind> or name=<file.wav>')
+    args = ap.parse_args()
+
+    clips = {}
+    for spec in args.clips:
+        name, src = spec.split('=', 1)
+        samples = synth(src[6:]) if src.startswith('synth:') else read_wav(src)
+        clips[name] = (adpcm_encode(samples), len(samples))
+
+    if args.output == '-':
+        emit(clips, sys.stdout)
+    else:
+        with open(args.output, 'w') as f:
+            emit(clips, f)
+
+
+if __name__ == '__main__':
+    main()
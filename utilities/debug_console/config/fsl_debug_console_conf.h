@@ -85,6 +85,19 @@
 #define DEBUG_CONSOLE_PRINTF_MAX_LOG_LEN (128U)
 #endif /* DEBUG_CONSOLE_PRINTF_MAX_LOG_LEN */
 
+/*!@brief Asynchronous PRINTF
+ * If the macro is nonzero, PRINTF formats into a per-task log ring and a low-priority task
+ * writes it out (source/log_console.h). Off in the benchmark build, which prints its
+ * histograms in one burst.
+ */
+#ifndef DEBUG_CONSOLE_ASYNC_LOG
+#if defined(RTOS_BENCH)
+#define DEBUG_CONSOLE_ASYNC_LOG (0U)
+#else
+#define DEBUG_CONSOLE_ASYNC_LOG (1U)
+#endif
+#endif /* DEBUG_CONSOLE_ASYNC_LOG */
+
 /*!@brief define the buffer support buffer scanf log length, that is when you call scanf("log", &x);, the log
  * length can not bigger than this value.
  * As same as the DEBUG_CONSOLE_BUFFER_PRINTF_MAX_LOG_LEN.
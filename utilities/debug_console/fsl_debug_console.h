@@ -22,6 +22,7 @@
 #define _FSL_DEBUGCONSOLE_H_
 
 #include "fsl_common.h"
+#include "fsl_debug_console_conf.h"
 
 /*!
  * @addtogroup debugconsole
@@ -72,7 +73,13 @@ static inline int DbgConsole_Disabled(void)
 #define PUTCHAR(...) DbgConsole_Disabled()
 #define GETCHAR()    DbgConsole_Disabled()
 #elif SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK /* Select printf, scanf, putchar, getchar of SDK version. */
+#if (DEBUG_CONSOLE_ASYNC_LOG > 0U)
+/* Formats into the calling task's log ring, see source/log_console.h */
+int LogConsole_Printf(const char *fmt_s, ...);
+#define PRINTF  LogConsole_Printf
+#else
 #define PRINTF  DbgConsole_Printf
+#endif /* DEBUG_CONSOLE_ASYNC_LOG */
 #define SCANF   DbgConsole_Scanf
 #define PUTCHAR DbgConsole_Putchar
 #define GETCHAR DbgConsole_Getchar
@@ -9,6 +9,7 @@
 #include <math.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h> /* MISRA C-2012 Rule 22.9 */
 #include "fsl_str.h"
 
@@ -74,6 +75,21 @@ static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int ne
  */
 static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t radix, uint32_t precision_width);
 
+#if (defined(PRINTF_FLOAT_FIXED_POINT) && (PRINTF_FLOAT_FIXED_POINT > 0U))
+/*!
+ * @brief Converts a double to a decimal string with integer arithmetic only.
+ *
+ * Writes the same reversed digits as ConvertFloatRadixNumToString (radix 10).
+ *
+ * @param[in] numstr            Converted string of the number, after the leading NUL.
+ * @param[in] r                 The number, not zero.
+ * @param[in] precision_width   Specify the precision width, at most FIXED_POINT_MAX_PRECISION.
+
+ * @return Length of the converted string, or -1 if the number must take the double routine.
+ */
+static int32_t ConvertFloatFixedPointToString(char *numstr, double r, uint32_t precision_width);
+#endif /* PRINTF_FLOAT_FIXED_POINT */
+
 #endif /* PRINTF_FLOAT_ENABLE */
 
 /*************Code for process formatted data*******************************/
@@ -654,6 +670,112 @@ static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int ne
 }
 
 #if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U))
+#if (defined(PRINTF_FLOAT_FIXED_POINT) && (PRINTF_FLOAT_FIXED_POINT > 0U))
+/* 10^9 is the largest power of ten in 32 bits. */
+#define FIXED_POINT_MAX_PRECISION (9U)
+/* Scaled fractions within 2^-16 of a rounding tie are left to the double routine: there its own
+ * rounding error (about 1e-6 at 9 digits) can decide the last digit. */
+#define FIXED_POINT_TIE_GUARD (1ULL << 48U)
+
+static uint32_t FixedPointDivideBy10(uint32_t a, uint32_t *rem)
+{
+    uint32_t q = (uint32_t)(((uint64_t)a * 0xCCCCCCCDULL) >> 35U);
+    *rem       = a - (q * 10U);
+    return q;
+}
+
+static int32_t ConvertFloatFixedPointToString(char *numstr, double r, uint32_t precision_width)
+{
+    static const uint32_t s_pow10[FIXED_POINT_MAX_PRECISION + 1U] = {
+        1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U};
+    uint64_t bits;
+    uint64_t mant;
+    uint64_t frac;
+    uint64_t lo;
+    uint64_t hi;
+    uint64_t rem;
+    uint32_t shift;
+    uint32_t ipart;
+    uint32_t fpart;
+    uint32_t scale = s_pow10[precision_width];
+    uint32_t digit;
+    uint32_t i;
+    int32_t nlen = 0;
+    char *nstrp  = numstr;
+
+    /* |r| = mant * 2^-shift; the sign is not printed by the caller's digits either way. */
+    (void)memcpy(&bits, &r, sizeof(bits));
+    mant  = bits & 0x000FFFFFFFFFFFFFULL;
+    shift = (uint32_t)((bits >> 52U) & 0x7FFU);
+    if (0U == shift)
+    {
+        shift = 1074U;
+    }
+    else
+    {
+        mant |= 1ULL << 52U;
+        /* |r| >= 2^29 (and Inf/NaN): keep the rounded integer part well inside int32. */
+        if (shift >= (1075U - 23U))
+        {
+            return -1;
+        }
+        shift = 1075U - shift;
+    }
+
+    /* Integer part, and the fraction as a 0.64 fixed-point number. */
+    if (shift >= 53U)
+    {
+        ipart = 0U;
+        frac  = (shift <= 64U) ? (mant << (64U - shift)) : ((shift < 128U) ? (mant >> (shift - 64U)) : 0U);
+    }
+    else
+    {
+        ipart = (uint32_t)(mant >> shift);
+        frac  = (mant & ((1ULL << shift) - 1U)) << (64U - shift);
+    }
+
+    /* fraction * 10^precision: the integer part is the digits, rem what is left below them. */
+    lo    = (frac & 0xFFFFFFFFU) * scale;
+    hi    = (frac >> 32U) * scale + (lo >> 32U);
+    fpart = (uint32_t)(hi >> 32U);
+    rem   = (hi << 32U) | (lo & 0xFFFFFFFFU);
+    if ((rem > ((1ULL << 63U) - FIXED_POINT_TIE_GUARD)) && (rem < ((1ULL << 63U) + FIXED_POINT_TIE_GUARD)))
+    {
+        return -1;
+    }
+    if (rem >= (1ULL << 63U))
+    {
+        fpart++;
+        if (fpart == scale)
+        {
+            fpart = 0U;
+            ipart++;
+        }
+    }
+
+    for (i = 0U; i < precision_width; i++)
+    {
+        fpart    = FixedPointDivideBy10(fpart, &digit);
+        *nstrp++ = (char)('0' + digit);
+        ++nlen;
+    }
+    *nstrp++ = (char)'.';
+    ++nlen;
+    if (0U == ipart)
+    {
+        *nstrp = '0';
+        ++nlen;
+    }
+    while (ipart != 0U)
+    {
+        ipart    = FixedPointDivideBy10(ipart, &digit);
+        *nstrp++ = (char)('0' + digit);
+        ++nlen;
+    }
+    return nlen;
+}
+#endif /* PRINTF_FLOAT_FIXED_POINT */
+
 static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t radix, uint32_t precision_width)
 {
     int32_t a;
@@ -680,6 +802,17 @@ static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t ra
         ++nlen;
         return nlen;
     }
+#if (defined(PRINTF_FLOAT_FIXED_POINT) && (PRINTF_FLOAT_FIXED_POINT > 0U))
+    if ((10 == radix) && (precision_width <= FIXED_POINT_MAX_PRECISION))
+    {
+        nlen = ConvertFloatFixedPointToString(nstrp, r, precision_width);
+        if (nlen >= 0)
+        {
+            return nlen;
+        }
+        nlen = 0;
+    }
+#endif /* PRINTF_FLOAT_FIXED_POINT */
     fractpart = modf((double)r, (double *)&intpart);
     /* Process fractional part. */
     for (i = 0; i < (int32_t)precision_width; i++)
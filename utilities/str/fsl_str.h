@@ -25,6 +25,16 @@
 #define PRINTF_FLOAT_ENABLE 0U
 #endif /* PRINTF_FLOAT_ENABLE */
 
+/*! @brief Definition to render %f with integer arithmetic.
+ * If nonzero (the default), %f with a precision of up to 9 digits converts the double to a scaled
+ * fixed-point integer once and emits digits with constant division, instead of repeated double
+ * multiply/divide. Values it cannot decide exactly fall back to the double routine, so the output
+ * is the same either way.
+ */
+#ifndef PRINTF_FLOAT_FIXED_POINT
+#define PRINTF_FLOAT_FIXED_POINT 1U
+#endif /* PRINTF_FLOAT_FIXED_POINT */
+
 /*! @brief Definition to scanf the float number. */
 #ifndef SCANF_FLOAT_ENABLE
 #define SCANF_FLOAT_ENABLE 0U